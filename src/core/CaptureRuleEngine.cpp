@@ -0,0 +1,308 @@
+#include "CaptureRuleEngine.hpp"
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QElapsedTimer>
+#include <QStandardPaths>
+#include <QDebug>
+#include <algorithm>
+
+namespace {
+bool actionFromString(const QString &name, RuleAction *action) {
+    if (name == "skip") *action = RuleAction::Skip;
+    else if (name == "redact") *action = RuleAction::Redact;
+    else if (name == "tag") *action = RuleAction::Tag;
+    else if (name == "expire") *action = RuleAction::Expire;
+    else return false;
+    return true;
+}
+
+bool isAsciiDigit(QChar c) {
+    return c >= QLatin1Char('0') && c <= QLatin1Char('9');
+}
+
+bool passesLuhn(const std::string &digits) {
+    int sum = 0;
+    bool doubled = false;
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it) {
+        int digit = *it - '0';
+        if (doubled) {
+            digit *= 2;
+            if (digit > 9) digit -= 9;
+        }
+        sum += digit;
+        doubled = !doubled;
+    }
+    return sum % 10 == 0;
+}
+
+// 후보 구간 안에서 카드 번호로 볼 수 있는 가장 긴 앞부분의 끝 위치, 없으면 -1
+// 숫자에 바로 붙은 구간과 주요 카드사(2~6)로 시작하지 않는 번호는 제외하므로 타임스탬프 같은 긴 숫자는 걸러집니다
+// End of the longest prefix of the candidate that is a plausible card number, -1 if none.
+// Runs glued to other digits and numbers not starting with a major-network digit (2–6) are rejected,
+// which filters out long numbers such as timestamps.
+int cardNumberEnd(const QString &text, int start, int end) {
+    if (start > 0 && isAsciiDigit(text.at(start - 1))) return -1;
+    std::string digits;
+    QVector<int> digitEnds;
+    for (int i = start; i < end && digits.size() < 19; ++i) {
+        if (!isAsciiDigit(text.at(i))) continue;
+        digits += char(text.at(i).unicode());
+        digitEnds.append(i + 1);
+    }
+    if (digits.size() < 13 || digits[0] < '2' || digits[0] > '6') return -1;
+    for (int length = int(digits.size()); length >= 13; --length) {
+        const int stop = digitEnds[length - 1];
+        if (stop < text.size() && isAsciiDigit(text.at(stop))) continue;
+        if (passesLuhn(digits.substr(0, length))) return stop;
+    }
+    return -1;
+}
+
+CaptureRule makeRule(const QString &name, const QString &pattern, RuleAction action, bool isRegex = true) {
+    CaptureRule rule;
+    rule.name = name;
+    rule.pattern = pattern;
+    rule.isRegex = isRegex;
+    rule.action = action;
+    return rule;
+}
+}
+
+QString CaptureRuleEngine::rulesPath() {
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    return QDir(dir).filePath("rules.json");
+}
+
+QList<CaptureRule> CaptureRuleEngine::defaultRules() {
+    QList<CaptureRule> rules;
+    rules << makeRule("AWS Access Key", "AKIA[0-9A-Z]{16}", RuleAction::Skip)
+          << makeRule("GitHub Token", "gh[pousr]_[A-Za-z0-9]{36}", RuleAction::Skip)
+          << makeRule("Slack Token", "xox[baprs]-[A-Za-z0-9-]{10,}", RuleAction::Skip)
+          << makeRule("Private Key", "-----BEGIN [A-Z ]*PRIVATE KEY-----", RuleAction::Skip)
+          << makeRule("JWT", "eyJ[A-Za-z0-9_-]{8,}\\.[A-Za-z0-9_-]{8,}\\.[A-Za-z0-9_-]{8,}", RuleAction::Redact)
+          << makeRule("Card Number", "\\d(?:[ -]?\\d){12,18}", RuleAction::Redact);
+    rules.last().check = RuleCheck::Luhn;
+
+    CaptureRule otp = makeRule("One-Time Code", "verification code", RuleAction::Expire, false);
+    otp.ignoreCase = true;
+    otp.ttlSeconds = 600;
+    rules << otp;
+    return rules;
+}
+
+bool CaptureRuleEngine::load(const QString &path) {
+    QFile file(path);
+    if (!file.exists()) {
+        setRules(defaultRules());
+        return true;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "규칙 파일 열기 실패:" << file.errorString();
+        setRules(defaultRules());
+        return false;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        qDebug() << "규칙 파일 파싱 실패:" << error.errorString();
+        setRules(defaultRules());
+        return false;
+    }
+
+    // 키 오타 등으로 규칙 배열이 없으면 보호 규칙이 모두 사라지지 않도록 기본 규칙 유지, 명시적인 빈 배열만 규칙 없음으로 봄
+    // A missing rules array (e.g. a typo in the key) keeps the defaults so protection is not silently dropped;
+    // only an explicit empty array means no rules
+    const QJsonValue rulesValue = doc.object().value("rules");
+    if (!rulesValue.isArray()) {
+        qDebug() << "규칙 파일에 rules 배열이 없어 기본 규칙을 사용합니다 (No rules array, using defaults):" << path;
+        setRules(defaultRules());
+        return false;
+    }
+
+    bool ok = true;
+    QList<CaptureRule> rules;
+    const QJsonArray array = rulesValue.toArray();
+    for (const QJsonValue &value : array) {
+        const QJsonObject obj = value.toObject();
+        CaptureRule rule;
+        rule.name = obj.value("name").toString();
+        rule.pattern = obj.value("pattern").toString();
+        rule.isRegex = obj.value("regex").toBool(true);
+        rule.ignoreCase = obj.value("ignoreCase").toBool(false);
+        const QString action = obj.value("action").toString();
+        if (!actionFromString(action, &rule.action)) {
+            // 오타 난 skip이 태그로 바뀌어 비밀이 저장되지 않도록 추측하지 않고 건너뜀 (Do not guess: a mistyped skip must not become a tag)
+            qDebug() << "알 수 없는 동작의 규칙 무시 (Ignoring rule with unknown action):" << rule.name << action;
+            ok = false;
+            continue;
+        }
+        rule.tag = obj.value("tag").toString(rule.name);
+        rule.ttlSeconds = obj.value("ttlSeconds").toInt(0);
+        if (obj.value("check").toString() == "luhn") rule.check = RuleCheck::Luhn;
+        if (!rule.pattern.isEmpty()) rules.append(rule);
+    }
+    setRules(rules);
+    return ok;
+}
+
+void CaptureRuleEngine::setRules(const QList<CaptureRule> &rules) {
+    m_rules = rules;
+    m_automaton = PatternAutomaton();
+    m_patternRule.clear();
+    m_fallback.clear();
+    m_redactRegex.clear();
+    m_stats = QVector<RuleStats>(m_rules.size());
+
+    for (int i = 0; i < m_rules.size(); ++i) {
+        const CaptureRule &rule = m_rules[i];
+        QRegularExpression::PatternOptions options = QRegularExpression::NoPatternOption;
+        if (rule.ignoreCase) options |= QRegularExpression::CaseInsensitiveOption;
+        QRegularExpression regex(rule.isRegex ? rule.pattern : QRegularExpression::escape(rule.pattern), options);
+        m_redactRegex.append(regex);
+
+        // 마스킹과 검증은 이 정규식으로 하므로 오토마톤이 받아들여도 여기서 거부 (Spans come from this regex, so reject it here even if the automaton would accept it)
+        if (!regex.isValid()) {
+            qDebug() << "잘못된 규칙 무시 (Ignoring invalid rule):" << rule.name << regex.errorString();
+            continue;
+        }
+
+        const std::string pattern = rule.pattern.toStdString();
+        int index = -1;
+        std::string error;
+        if (rule.isRegex) {
+            index = m_automaton.addRegex(pattern, rule.ignoreCase, &error);
+        } else {
+            index = m_automaton.addLiteral(pattern, rule.ignoreCase, &error);
+        }
+
+        if (index >= 0) {
+            m_patternRule.resize(index + 1);
+            m_patternRule[index] = i;
+        } else {
+            // 오토마톤이 지원하지 않는 문법은 개별 정규식으로 검사 (Unsupported syntax is checked on its own)
+            qDebug() << "규칙이 단일 패스 엔진 밖에서 실행됩니다 (Rule runs outside the single-pass engine):"
+                     << rule.name << QString::fromStdString(error);
+            regex.optimize();
+            m_fallback.append(qMakePair(i, regex));
+        }
+    }
+    m_automaton.compile();
+}
+
+CaptureDecision CaptureRuleEngine::evaluate(const QString &text) {
+    QElapsedTimer timer;
+    timer.start();
+
+    CaptureDecision decision;
+    decision.text = text;
+
+    const QByteArray utf8 = text.toUtf8();
+    m_matches.clear();
+    m_automaton.scan(utf8.constData(), static_cast<size_t>(utf8.size()), m_matches);
+
+    QVector<bool> matched(m_rules.size(), false);
+    for (const PatternAutomaton::Match &match : m_matches) {
+        matched[m_patternRule[match.pattern]] = true;
+    }
+    for (const auto &fallback : m_fallback) {
+        if (fallback.second.match(text).hasMatch()) matched[fallback.first] = true;
+    }
+
+    QVector<QPair<int, int>> spans;
+    QVector<QPair<int, int>> ruleSpans;
+    for (int i = 0; i < m_rules.size(); ++i) {
+        if (!matched[i]) continue;
+        const CaptureRule &rule = m_rules[i];
+        ruleSpans.clear();
+        if (rule.check != RuleCheck::None || rule.action == RuleAction::Redact) {
+            collectSpans(i, text, &ruleSpans);
+            // 검증을 통과한 위치가 없으면 후보였을 뿐 (Without a validated span it was only a candidate)
+            if (rule.check != RuleCheck::None && ruleSpans.isEmpty()) continue;
+            // 두 엔진의 판단이 다르면 가리지 못한 채 저장하지 않고 저장 자체를 막음 (If the engines disagree, drop the item rather than store it unmasked)
+            if (rule.action == RuleAction::Redact && ruleSpans.isEmpty()) {
+                qDebug() << "마스킹 위치를 찾지 못해 저장하지 않습니다 (No redaction span found, not storing):" << rule.name;
+                decision.skip = true;
+            }
+        }
+        ++m_stats[i].hits;
+        decision.matchedRules.append(rule.name);
+
+        switch (rule.action) {
+        case RuleAction::Skip:
+            decision.skip = true;
+            break;
+        case RuleAction::Tag:
+            if (!decision.tags.contains(rule.tag)) decision.tags.append(rule.tag);
+            break;
+        case RuleAction::Expire:
+            if (rule.ttlSeconds > 0 && (decision.ttlSeconds == 0 || rule.ttlSeconds < decision.ttlSeconds)) {
+                decision.ttlSeconds = rule.ttlSeconds;
+            }
+            break;
+        case RuleAction::Redact:
+            spans += ruleSpans;
+            break;
+        }
+    }
+
+    if (!decision.skip && !spans.isEmpty()) {
+        // 겹치는 구간을 합친 뒤 뒤에서부터 치환 (Merge overlapping spans, then replace from the back)
+        std::sort(spans.begin(), spans.end());
+        QVector<QPair<int, int>> merged;
+        for (const auto &span : spans) {
+            if (!merged.isEmpty() && span.first <= merged.last().second) {
+                merged.last().second = std::max(merged.last().second, span.second);
+            } else {
+                merged.append(span);
+            }
+        }
+        for (int i = merged.size() - 1; i >= 0; --i) {
+            decision.text.replace(merged[i].first, merged[i].second - merged[i].first, "[REDACTED]");
+        }
+    }
+
+    const qint64 elapsed = timer.nsecsElapsed();
+    ++m_scans;
+    m_scannedBytes += static_cast<quint64>(utf8.size());
+    m_totalNs += elapsed;
+    m_maxNs = std::max(m_maxNs, elapsed);
+    return decision;
+}
+
+void CaptureRuleEngine::collectSpans(int rule, const QString &text, QVector<QPair<int, int>> *spans) const {
+    QRegularExpressionMatchIterator it = m_redactRegex[rule].globalMatch(text);
+    while (it.hasNext()) {
+        const QRegularExpressionMatch match = it.next();
+        if (match.capturedLength() == 0) continue;
+        int end = match.capturedEnd();
+        if (m_rules[rule].check == RuleCheck::Luhn) {
+            end = cardNumberEnd(text, match.capturedStart(), end);
+            if (end < 0) continue;
+        }
+        spans->append(qMakePair(match.capturedStart(), end));
+    }
+}
+
+QString CaptureRuleEngine::statsSummary() const {
+    QStringList lines;
+    const double avgUs = m_scans ? (m_totalNs / 1000.0) / m_scans : 0.0;
+    const double mbPerSec = m_totalNs ? (m_scannedBytes / 1048576.0) / (m_totalNs / 1e9) : 0.0;
+    lines << QString("검사 (Scans): %1 | 평균 (Avg): %2 µs | 최대 (Max): %3 µs | %4 MB/s")
+                 .arg(m_scans)
+                 .arg(avgUs, 0, 'f', 1)
+                 .arg(m_maxNs / 1000.0, 0, 'f', 1)
+                 .arg(mbPerSec, 0, 'f', 1);
+    lines << QString("단일 패스 패턴 (Single-pass patterns): %1 | 개별 정규식 (Fallback regexes): %2 | DFA 상태 (DFA states): %3")
+                 .arg(m_automaton.patternCount())
+                 .arg(m_fallback.size())
+                 .arg(m_automaton.dfaStateCount());
+    for (int i = 0; i < m_rules.size(); ++i) {
+        lines << QString("  • %1: %2").arg(m_rules[i].name).arg(m_stats[i].hits);
+    }
+    return lines.join("\n");
+}
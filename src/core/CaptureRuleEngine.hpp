@@ -0,0 +1,155 @@
+/**
+ * @file CaptureRuleEngine.hpp
+ * @brief 캡처 시점 규칙 엔진 클래스 (Capture-Time Rule Engine Class)
+ *
+ * 비밀 정보 제외, 마스킹, 태그 지정, 만료 설정 규칙을 하나의 오토마톤으로 컴파일하여
+ * 클립보드 내용마다 한 번만 훑어 평가합니다.
+ * Compiles skip, redact, tag and expire rules into one automaton and evaluates
+ * every clipboard payload in a single pass.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef CAPTURERULEENGINE_HPP
+#define CAPTURERULEENGINE_HPP
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QVector>
+#include <QPair>
+#include <QRegularExpression>
+#include "PatternAutomaton.hpp"
+
+/**
+ * @enum RuleAction
+ * @brief 규칙이 매칭되었을 때의 동작 (Action taken when a rule matches)
+ */
+enum class RuleAction {
+    Skip,    ///< 저장하지 않음 (Do not store)
+    Redact,  ///< 매칭 부분을 가림 (Mask the matched text)
+    Tag,     ///< 태그 추가 (Add a tag)
+    Expire   ///< 일정 시간 후 삭제 (Delete after a delay)
+};
+
+/**
+ * @enum RuleCheck
+ * @brief 매칭 후보에 대한 추가 검증 (Extra validation applied to match candidates)
+ */
+enum class RuleCheck {
+    None,  ///< 검증 없음 (No validation)
+    Luhn   ///< 13~19자리 카드 번호와 Luhn 검사 (13–19 digit card number with a Luhn check)
+};
+
+/**
+ * @struct CaptureRule
+ * @brief 사용자 정의 캡처 규칙 (User-defined capture rule)
+ */
+struct CaptureRule {
+    QString name;             ///< 규칙 이름 (Rule name)
+    QString pattern;          ///< 리터럴 또는 정규식 (Literal or regex)
+    bool isRegex = true;      ///< 정규식 여부 (Whether the pattern is a regex)
+    bool ignoreCase = false;  ///< 대소문자 무시 (Case-insensitive)
+    RuleAction action = RuleAction::Tag; ///< 동작 (Action)
+    QString tag;              ///< Tag 동작의 태그 (Tag for the Tag action)
+    int ttlSeconds = 0;       ///< Expire 동작의 보존 시간 (Retention for the Expire action)
+    RuleCheck check = RuleCheck::None; ///< 후보 검증 방식 (Candidate validation)
+};
+
+/**
+ * @struct CaptureDecision
+ * @brief 규칙 평가 결과 (Result of rule evaluation)
+ */
+struct CaptureDecision {
+    bool skip = false;        ///< 저장 생략 여부 (Whether to drop the item)
+    QString text;             ///< 마스킹이 적용된 내용 (Content after redaction)
+    QStringList tags;         ///< 추가할 태그 (Tags to attach)
+    int ttlSeconds = 0;       ///< 만료 시간, 0이면 없음 (Expiry in seconds, 0 for none)
+    QStringList matchedRules; ///< 매칭된 규칙 이름 (Names of matched rules)
+};
+
+/**
+ * @class CaptureRuleEngine
+ * @brief 캡처 규칙 컴파일 및 평가 엔진 (Capture Rule Compilation and Evaluation Engine)
+ *
+ * 리터럴과 지원 문법의 정규식은 PatternAutomaton 하나로 함께 실행되고, 지원하지 않는 패턴만
+ * QRegularExpression으로 따로 검사합니다. 마스킹 위치는 매칭된 Redact 규칙에 대해서만 계산하며,
+ * 검증이 있는 규칙은 오토마톤 매칭을 후보로만 보고 검증을 통과한 위치가 있어야 매칭으로 칩니다.
+ * Literals and supported regexes run together in one PatternAutomaton; only unsupported patterns
+ * fall back to QRegularExpression. Redaction spans are computed only for Redact rules that matched.
+ * For rules with a check, an automaton match is only a candidate; the rule counts as matched only
+ * when at least one span passes validation.
+ */
+class CaptureRuleEngine {
+public:
+    /**
+     * @brief 규칙별 통계 (Per-rule statistics)
+     */
+    struct RuleStats {
+        quint64 hits = 0;  ///< 매칭 횟수 (Number of matches)
+    };
+
+    /**
+     * @brief 규칙 파일 경로 (Rule file path)
+     * @return 사용자 데이터 디렉터리의 rules.json (rules.json in the user data directory)
+     */
+    static QString rulesPath();
+
+    /**
+     * @brief 기본 제공 규칙 (Built-in rules)
+     * @return API 키, JWT, 카드 번호 등 (API keys, JWTs, card numbers, etc.)
+     */
+    static QList<CaptureRule> defaultRules();
+
+    /**
+     * @brief JSON 파일에서 규칙 불러오기, 파일이 없으면 기본 규칙 사용 (Load rules from JSON, defaults if missing)
+     *
+     * 파일을 읽을 수 없거나 rules 배열이 없으면 기본 규칙을 사용하고, 동작 이름을 알 수 없는 규칙은 건너뜁니다.
+     * Unreadable files or a missing rules array fall back to the defaults; rules with an unknown action are skipped.
+     * @param path 규칙 파일 경로 (Rule file path)
+     * @return 문제 없이 읽었으면 true (True if the file loaded without problems)
+     */
+    bool load(const QString &path);
+
+    /**
+     * @brief 규칙 설정 및 컴파일 (Set and compile rules)
+     * @param rules 규칙 목록 (Rule list)
+     */
+    void setRules(const QList<CaptureRule> &rules);
+
+    /**
+     * @brief 클립보드 내용에 규칙 적용 (Apply the rules to clipboard content)
+     * @param text 원본 내용 (Original content)
+     * @return 평가 결과 (Decision)
+     */
+    CaptureDecision evaluate(const QString &text);
+
+    /**
+     * @brief 매칭 통계 요약 문자열 (Human-readable matching statistics)
+     * @return 요약 (Summary)
+     */
+    QString statsSummary() const;
+
+    /// 규칙 수 (Number of rules)
+    int ruleCount() const { return m_rules.size(); }
+
+private:
+    /// 규칙의 매칭 위치 수집, 검증이 있으면 통과한 위치만 (Collect a rule's spans, only validated ones if it has a check)
+    void collectSpans(int rule, const QString &text, QVector<QPair<int, int>> *spans) const;
+
+    QList<CaptureRule> m_rules;
+    PatternAutomaton m_automaton;
+    QVector<int> m_patternRule;                         ///< 오토마톤 패턴 번호 → 규칙 번호 (Automaton pattern → rule index)
+    QVector<QPair<int, QRegularExpression>> m_fallback; ///< 오토마톤이 지원하지 않는 패턴 (Patterns the automaton cannot handle)
+    QVector<QRegularExpression> m_redactRegex;          ///< 마스킹 및 검증 위치 계산용 (Used to locate redaction and validation spans)
+    std::vector<PatternAutomaton::Match> m_matches;     ///< 재사용 버퍼 (Reused buffer)
+
+    QVector<RuleStats> m_stats;
+    quint64 m_scans = 0;
+    quint64 m_scannedBytes = 0;
+    qint64 m_totalNs = 0;
+    qint64 m_maxNs = 0;
+};
+
+#endif // CAPTURERULEENGINE_HPP
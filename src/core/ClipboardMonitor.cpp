@@ -3,6 +3,11 @@
 ClipboardMonitor::ClipboardMonitor(QObject *parent) : QObject(parent) {
     m_clipboard = QApplication::clipboard();
     connect(m_clipboard, &QClipboard::dataChanged, this, &ClipboardMonitor::onClipboardChanged);
+    reloadRules();
+}
+
+void ClipboardMonitor::reloadRules() {
+    m_rules.load(CaptureRuleEngine::rulesPath());
 }
 
 void ClipboardMonitor::onClipboardChanged() {
@@ -10,7 +15,10 @@ void ClipboardMonitor::onClipboardChanged() {
     if (mimeData->hasText()) {
         QString text = mimeData->text();
         if (!text.isEmpty()) {
-            emit contentChanged(text);
+            CaptureDecision decision = m_rules.evaluate(text);
+            if (!decision.skip) {
+                emit contentChanged(decision.text, decision.tags, decision.ttlSeconds);
+            }
         }
     }
 }
@@ -16,6 +16,8 @@
 #include <QClipboard>
 #include <QMimeData>
 #include <QApplication>
+#include <QStringList>
+#include "CaptureRuleEngine.hpp"
 
 /**
  * @class ClipboardMonitor
@@ -26,12 +28,28 @@ class ClipboardMonitor : public QObject {
 public:
     explicit ClipboardMonitor(QObject *parent = nullptr);
 
+    /**
+     * @brief 규칙 파일 다시 불러오기 (Reload the capture rule file)
+     */
+    void reloadRules();
+
+    /**
+     * @brief 캡처 규칙 엔진 (Capture rule engine)
+     * @return 엔진 참조 (Engine reference)
+     */
+    const CaptureRuleEngine &rules() const { return m_rules; }
+
 signals:
     /**
      * @brief 클립보드 내용이 변경되었을 때 발생하는 신호 (Signal emitted when clipboard content changes)
+     *
+     * Skip 규칙에 걸린 내용은 신호를 보내지 않으며, Redact 규칙은 이미 적용된 상태입니다.
+     * Not emitted for content caught by a Skip rule; Redact rules are already applied.
      * @param text 새로운 내용 (New content)
+     * @param tags 규칙이 붙인 태그 (Tags attached by rules)
+     * @param ttlSeconds 만료 시간, 0이면 없음 (Expiry in seconds, 0 for none)
      */
-    void contentChanged(const QString &text);
+    void contentChanged(const QString &text, const QStringList &tags, int ttlSeconds);
 
 private slots:
     /**
@@ -41,6 +59,7 @@ private slots:
 
 private:
     QClipboard *m_clipboard; ///< 시스템 클립보드 포인터 (Pointer to system clipboard)
+    CaptureRuleEngine m_rules; ///< 캡처 규칙 엔진 (Capture rule engine)
 };
 
 #endif // CLIPBOARDMONITOR_HPP
@@ -1,4 +1,28 @@
 #include "DatabaseManager.hpp"
+#include <QSet>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include "../plugins/TextProcessor.hpp"
+
+namespace {
+// 캡처와 가져오기가 공유하는 중복 규칙 (Dedup rule shared by capture and import)
+const char *kMergeSql = "UPDATE clipboard_history SET "
+                        "timestamp = MAX(timestamp, COALESCE(:ts, CURRENT_TIMESTAMP)), "
+                        "is_pinned = MAX(is_pinned, :pinned), "
+                        "tags = CASE WHEN COALESCE(tags, '') = '' THEN COALESCE(:tags, tags) ELSE tags END "
+                        "WHERE content_hash = :hash AND content = :content";
+const char *kInsertSql = "INSERT INTO clipboard_history (content, timestamp, is_pinned, type, content_hash, simhash, group_id, tags, expires_at) "
+                         "VALUES (:content, COALESCE(:ts, CURRENT_TIMESTAMP), :pinned, :type, :hash, :simhash, :group, "
+                         "COALESCE(:tags, ''), :expires)";
+
+// 잠금 대기 한도와 변경 로그 보존 길이 (Lock wait limit and change-log retention)
+const int kBusyTimeoutMs = 5000;
+const int kChangeLogKeep = 10000;
+// 한 번에 이보다 많이 바뀌면 개별 갱신 대신 전체 갱신 (Above this, a full reload beats per-item updates)
+const int kMaxIncrementalChanges = 500;
+}
 
 DatabaseManager::DatabaseManager(QObject *parent) : QObject(parent) {}
 
@@ -8,9 +32,28 @@ DatabaseManager::~DatabaseManager() {
     }
 }
 
+QString DatabaseManager::databasePath() {
+    const QString overridePath = qEnvironmentVariable("CLIPSMITH_DB_PATH");
+    if (!overridePath.isEmpty()) {
+        return QFileInfo(overridePath).absoluteFilePath();
+    }
+    const QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    return QDir(dir).filePath("clipsmith.db");
+}
+
 bool DatabaseManager::init() {
+    const QString path = databasePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    // 이전 버전은 작업 디렉터리에 DB를 만들었으므로 처음 한 번 옮겨 옵니다
+    // Older versions created the DB in the working directory; carry it over once
+    if (!QFile::exists(path) && QFile::exists("clipsmith.db")) {
+        QFile::copy("clipsmith.db", path);
+    }
+
     m_db = QSqlDatabase::addDatabase("QSQLITE");
-    m_db.setDatabaseName("clipsmith.db");
+    m_db.setDatabaseName(path);
+    m_db.setConnectOptions(QString("QSQLITE_BUSY_TIMEOUT=%1").arg(kBusyTimeoutMs));
 
     if (!m_db.open()) {
         qDebug() << "데이터베이스 연결 실패:" << m_db.lastError().text();
@@ -18,6 +61,13 @@ bool DatabaseManager::init() {
     }
 
     QSqlQuery query;
+    // 여러 프로세스가 읽는 동안에도 쓰기가 막히지 않도록 WAL 사용
+    // WAL lets readers in other processes proceed while one process writes
+    if (!query.exec("PRAGMA journal_mode=WAL")) {
+        qDebug() << "WAL 설정 실패:" << query.lastError().text();
+    }
+    query.exec("PRAGMA synchronous=NORMAL");
+
     QString createTable = "CREATE TABLE IF NOT EXISTS clipboard_history ("
                           "id INTEGER PRIMARY KEY AUTOINCREMENT, "
                           "content TEXT NOT NULL, "
@@ -30,25 +80,530 @@ bool DatabaseManager::init() {
         return false;
     }
 
+    return migrateSchema();
+}
+
+bool DatabaseManager::migrateSchema() {
+    QSet<QString> columns;
+    QSqlQuery info("PRAGMA table_info(clipboard_history)");
+    while (info.next()) {
+        columns.insert(info.value(1).toString());
+    }
+
+    QSqlQuery query;
+    const QList<QPair<QString, QString>> added = {
+        {"content_hash", "INTEGER"},
+        {"tags", "TEXT DEFAULT ''"},
+        {"expires_at", "DATETIME"},
+        {"simhash", "INTEGER"},
+        {"group_id", "INTEGER"}
+    };
+    for (const auto &column : added) {
+        if (columns.contains(column.first)) continue;
+        if (!query.exec(QString("ALTER TABLE clipboard_history ADD COLUMN %1 %2").arg(column.first, column.second))) {
+            qDebug() << "스키마 갱신 실패:" << query.lastError().text();
+            return false;
+        }
+    }
+
+    // 해시가 없는 기존 행 채우기 (Backfill hashes for rows written by older versions)
+    if (!m_db.transaction()) {
+        qDebug() << "트랜잭션 시작 실패:" << m_db.lastError().text();
+        return false;
+    }
+    {
+        QSqlQuery pending;
+        pending.setForwardOnly(true);
+        QSqlQuery fill;
+        bool ok = pending.exec("SELECT id, content FROM clipboard_history WHERE content_hash IS NULL")
+                  && fill.prepare("UPDATE clipboard_history SET content_hash = :hash WHERE id = :id");
+        while (ok && pending.next()) {
+            fill.bindValue(":hash", contentHash(pending.value(1).toString()));
+            fill.bindValue(":id", pending.value(0).toInt());
+            ok = fill.exec();
+        }
+        if (!ok) {
+            // 해시가 빠진 행은 중복 검사에서 보이지 않으므로 여기서 멈춤 (Rows without a hash are invisible to dedup, so stop here)
+            qDebug() << "해시 채우기 실패:" << pending.lastError().text() << fill.lastError().text();
+            pending.finish();
+            fill.finish();
+            m_db.rollback();
+            return false;
+        }
+    }
+    if (!m_db.commit()) {
+        qDebug() << "트랜잭션 커밋 실패:" << m_db.lastError().text();
+        m_db.rollback();
+        return false;
+    }
+
+    loadSimilarityIndex();
+    if (!backfillSimilarity()) {
+        return false;
+    }
+
+    if (!query.exec("CREATE INDEX IF NOT EXISTS idx_history_hash ON clipboard_history (content_hash)") ||
+        !query.exec("CREATE INDEX IF NOT EXISTS idx_history_expires ON clipboard_history (expires_at)")) {
+        qDebug() << "인덱스 생성 실패:" << query.lastError().text();
+        return false;
+    }
+
+    // 다른 프로세스가 증분 갱신할 수 있도록 변경된 항목 ID를 기록
+    // Record changed item IDs so other processes can update incrementally
+    const QStringList changeLog = {
+        "CREATE TABLE IF NOT EXISTS history_changes ("
+        "seq INTEGER PRIMARY KEY AUTOINCREMENT, "
+        "item_id INTEGER NOT NULL)",
+        "CREATE TRIGGER IF NOT EXISTS trg_history_insert AFTER INSERT ON clipboard_history "
+        "BEGIN INSERT INTO history_changes (item_id) VALUES (NEW.id); END",
+        "CREATE TRIGGER IF NOT EXISTS trg_history_update AFTER UPDATE ON clipboard_history "
+        "BEGIN INSERT INTO history_changes (item_id) VALUES (NEW.id); END",
+        "CREATE TRIGGER IF NOT EXISTS trg_history_delete AFTER DELETE ON clipboard_history "
+        "BEGIN INSERT INTO history_changes (item_id) VALUES (OLD.id); END"
+    };
+    for (const QString &sql : changeLog) {
+        if (!query.exec(sql)) {
+            qDebug() << "변경 로그 생성 실패:" << query.lastError().text();
+            return false;
+        }
+    }
+
+    pruneChangeLog();
+    if (query.exec("SELECT COALESCE(MAX(seq), 0) FROM history_changes") && query.next()) {
+        m_lastChangeSeq = query.value(0).toLongLong();
+    }
     return true;
 }
 
-bool DatabaseManager::saveItem(const QString &content, const QString &type) {
+void DatabaseManager::startWatching(int intervalMs) {
+    if (!m_watchTimer) {
+        m_watchTimer = new QTimer(this);
+        connect(m_watchTimer, &QTimer::timeout, this, &DatabaseManager::pollChanges);
+    }
+    m_watchTimer->start(intervalMs);
+
+    if (!m_expiryTimer) {
+        m_expiryTimer = new QTimer(this);
+        connect(m_expiryTimer, &QTimer::timeout, this, &DatabaseManager::purgeExpired);
+        // 변경 로그는 캡처마다 늘어나므로 같은 주기로 정리 (The change log grows with every capture, so trim it on the same cadence)
+        connect(m_expiryTimer, &QTimer::timeout, this, &DatabaseManager::pruneChangeLog);
+    }
+    m_expiryTimer->start(30000);
+    purgeExpired();
+}
+
+void DatabaseManager::purgeExpired() {
+    // 만료 항목이 없으면 쓰기 잠금을 잡지 않음 (Skip the write lock when nothing has expired)
     QSqlQuery query;
-    query.prepare("INSERT INTO clipboard_history (content, type) VALUES (:content, :type)");
-    query.bindValue(":content", content);
-    query.bindValue(":type", type);
+    if (!query.exec("SELECT 1 FROM clipboard_history WHERE expires_at IS NOT NULL AND expires_at <= CURRENT_TIMESTAMP LIMIT 1")
+        || !query.next()) {
+        return;
+    }
+    // 읽기 문장을 닫아야 쓰기 잠금이 오래된 스냅숏에 묶이지 않음 (Close the read so the write lock is not tied to a stale snapshot)
+    query.finish();
+    if (!beginLocalWrite()) return;
+
+    // 잠금 안에서 고른 ID만 지워야 알리는 목록과 실제 삭제가 일치함
+    // Select inside the lock and delete exactly those IDs, so the notified list matches what was deleted
+    QList<int> ids;
+    if (!query.exec("SELECT id FROM clipboard_history WHERE expires_at IS NOT NULL AND expires_at <= CURRENT_TIMESTAMP")) {
+        qDebug() << "만료 항목 조회 실패:" << query.lastError().text();
+        m_db.rollback();
+        return;
+    }
+    while (query.next()) {
+        ids.append(query.value(0).toInt());
+    }
+    query.finish();
+
+    QSqlQuery remove;
+    remove.prepare("DELETE FROM clipboard_history WHERE id = :id");
+    for (int id : ids) {
+        remove.bindValue(":id", id);
+        if (!remove.exec()) {
+            qDebug() << "만료 항목 삭제 실패:" << remove.lastError().text();
+            m_db.rollback();
+            return;
+        }
+    }
+    remove.finish();
+    if (!commitLocalWrite()) return;
+    if (ids.isEmpty()) return;
+
+    for (int id : ids) {
+        m_similar.remove(id);
+    }
+    // 자기 연결의 삭제는 data_version에 잡히지 않으므로 직접 알림 (Own deletes do not move data_version, so notify directly)
+    emit itemsExpired(ids);
+}
+
+void DatabaseManager::pollChanges() {
+    // data_version은 다른 연결이 커밋했을 때만 바뀌므로 평소에는 이 쿼리 하나로 끝납니다
+    // data_version only moves when another connection commits, so idle polls cost one pragma
+    QSqlQuery query;
+    if (!query.exec("PRAGMA data_version") || !query.next()) return;
+    const qint64 version = query.value(0).toLongLong();
+    if (version == m_dataVersion) return;
+    m_dataVersion = version;
+
+    qint64 minSeq = 0;
+    qint64 maxSeq = 0;
+    if (query.exec("SELECT COALESCE(MIN(seq), 0), COALESCE(MAX(seq), 0) FROM history_changes") && query.next()) {
+        minSeq = query.value(0).toLongLong();
+        maxSeq = query.value(1).toLongLong();
+    }
+    if (maxSeq <= m_lastChangeSeq) return;
+
+    // 이 프로세스가 쓴 구간은 이미 반영되어 있으므로 다른 프로세스의 변경만 셈
+    // Ranges this process wrote are already applied, so count only changes from other processes
+    auto isOwn = [this](qint64 seq) {
+        for (const auto &own : m_ownChanges) {
+            if (seq > own.first && seq <= own.second) return true;
+        }
+        return false;
+    };
+    qint64 foreign = maxSeq - m_lastChangeSeq;
+    for (const auto &own : m_ownChanges) {
+        foreign -= own.second - own.first;
+    }
+
+    // 놓친 기록이 정리되었거나 변경량이 너무 많으면 전체 갱신
+    // Fall back to a full reload if entries we missed were pruned or there are too many
+    if (foreign <= 0) {
+        m_lastChangeSeq = maxSeq;
+    } else if (minSeq > m_lastChangeSeq + 1 || foreign > kMaxIncrementalChanges) {
+        m_lastChangeSeq = maxSeq;
+        loadSimilarityIndex();
+        emit historyReset();
+    } else {
+        QList<int> ids;
+        QSet<int> seen;
+        query.prepare("SELECT seq, item_id FROM history_changes WHERE seq > :seq AND seq <= :max ORDER BY seq");
+        query.bindValue(":seq", m_lastChangeSeq);
+        query.bindValue(":max", maxSeq);
+        if (!query.exec()) return;
+        while (query.next()) {
+            if (isOwn(query.value(0).toLongLong())) continue;
+            int id = query.value(1).toInt();
+            if (!seen.contains(id)) {
+                seen.insert(id);
+                ids.append(id);
+            }
+        }
+        m_lastChangeSeq = maxSeq;
+        refreshSimilarity(ids);
+        if (!ids.isEmpty()) emit itemsChanged(ids);
+    }
+    m_ownChanges.clear();
+}
+
+void DatabaseManager::pruneChangeLog() {
+    // 오래된 변경 기록 정리 (Prune old change-log entries)
+    QSqlQuery query;
+    if (!query.exec("SELECT COALESCE(MIN(seq), 0), COALESCE(MAX(seq), 0) FROM history_changes") || !query.next()) return;
+    const qint64 minSeq = query.value(0).toLongLong();
+    const qint64 maxSeq = query.value(1).toLongLong();
+    if (maxSeq - minSeq < kChangeLogKeep) return;
+
+    query.prepare("DELETE FROM history_changes WHERE seq <= :cutoff");
+    query.bindValue(":cutoff", maxSeq - kChangeLogKeep);
+    query.exec();
+}
+
+bool DatabaseManager::beginLocalWrite() {
+    // IMMEDIATE로 쓰기 잠금을 먼저 잡아야 아래에서 읽은 순번 뒤에 다른 프로세스가 끼어들지 못함
+    // IMMEDIATE takes the write lock first, so no other process can commit after the sequence read below
+    QSqlQuery query;
+    if (!query.exec("BEGIN IMMEDIATE")) {
+        qDebug() << "트랜잭션 시작 실패:" << query.lastError().text();
+        return false;
+    }
+    m_writeStartSeq = 0;
+    if (query.exec("SELECT COALESCE(MAX(seq), 0) FROM history_changes") && query.next()) {
+        m_writeStartSeq = query.value(0).toLongLong();
+    }
+    return true;
+}
+
+bool DatabaseManager::commitLocalWrite() {
+    qint64 endSeq = m_writeStartSeq;
+    {
+        QSqlQuery query;
+        if (query.exec("SELECT COALESCE(MAX(seq), 0) FROM history_changes") && query.next()) {
+            endSeq = query.value(0).toLongLong();
+        }
+    }
+    if (!m_db.commit()) {
+        qDebug() << "트랜잭션 커밋 실패:" << m_db.lastError().text();
+        m_db.rollback();
+        return false;
+    }
+    if (endSeq <= m_writeStartSeq) return true;
+
+    // 앞에 읽지 않은 변경이 없으면 바로 따라잡고, 있으면 구간을 남겨 폴링이 건너뛰게 함
+    // With nothing unread before it, catch up directly; otherwise keep the range for polling to skip
+    if (m_writeStartSeq == m_lastChangeSeq) {
+        m_lastChangeSeq = endSeq;
+    } else {
+        m_ownChanges.append(qMakePair(m_writeStartSeq, endSeq));
+    }
+    return true;
+}
+
+bool DatabaseManager::getItem(int id, ClipboardItem *item) {
+    QSqlQuery query;
+    query.prepare("SELECT id, content, timestamp, is_pinned, type, tags, COALESCE(group_id, id) FROM clipboard_history WHERE id = :id");
+    query.bindValue(":id", id);
+    if (!query.exec() || !query.next()) {
+        return false;
+    }
+    item->id = query.value(0).toInt();
+    item->content = query.value(1).toString();
+    item->timestamp = query.value(2).toDateTime();
+    item->isPinned = query.value(3).toBool();
+    item->type = query.value(4).toString();
+    item->tags = query.value(5).toString().split(',', Qt::SkipEmptyParts);
+    item->groupId = query.value(6).toInt();
+    return true;
+}
+
+qint64 DatabaseManager::contentHash(const QString &content) {
+    // 저장되는 값이므로 프로세스마다 시드가 바뀌는 qHash 대신 FNV-1a를 사용
+    // Stored on disk, so use FNV-1a rather than the per-process seeded qHash
+    quint64 hash = 14695981039346656037ULL;
+    const QChar *data = content.constData();
+    for (int i = 0; i < content.size(); ++i) {
+        hash ^= data[i].unicode();
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<qint64>(hash);
+}
+
+void DatabaseManager::loadSimilarityIndex() {
+    m_similar.clear();
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.exec("SELECT id, simhash, COALESCE(group_id, id) FROM clipboard_history "
+               "WHERE simhash IS NOT NULL AND simhash != 0");
+    while (query.next()) {
+        m_similar.insert(query.value(0).toInt(), static_cast<quint64>(query.value(1).toLongLong()), query.value(2).toInt());
+    }
+}
+
+bool DatabaseManager::backfillSimilarity() {
+    // 이전 버전 행에 지문과 그룹을 ID 순서대로 한 번만 부여 (Fingerprint and group older rows once, in ID order)
+    QList<QPair<int, quint64>> pending;
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    query.exec("SELECT id, content FROM clipboard_history WHERE simhash IS NULL ORDER BY id");
+    while (query.next()) {
+        pending.append(qMakePair(query.value(0).toInt(), TextProcessor::simHash(query.value(1).toString())));
+    }
+    if (pending.isEmpty()) return true;
+
+    if (!m_db.transaction()) {
+        qDebug() << "트랜잭션 시작 실패:" << m_db.lastError().text();
+        return false;
+    }
+    {
+        QSqlQuery fill;
+        bool ok = fill.prepare("UPDATE clipboard_history SET simhash = :simhash, group_id = :group WHERE id = :id");
+        for (int i = 0; ok && i < pending.size(); ++i) {
+            const auto &row = pending.at(i);
+            int group = -1;
+            if (row.second != 0) {
+                group = m_similar.findGroup(row.second);
+                m_similar.insert(row.first, row.second, group >= 0 ? group : row.first);
+            }
+            fill.bindValue(":simhash", static_cast<qint64>(row.second));
+            fill.bindValue(":group", group >= 0 ? QVariant(group) : QVariant());
+            fill.bindValue(":id", row.first);
+            ok = fill.exec();
+        }
+        if (!ok) {
+            // 색인에는 이미 들어간 그룹이 DB에는 없으므로 되돌린 뒤 다시 읽음 (The index holds groups the DB lacks, so reload it after rolling back)
+            qDebug() << "유사 지문 채우기 실패:" << fill.lastError().text();
+            fill.finish();
+            m_db.rollback();
+            loadSimilarityIndex();
+            return false;
+        }
+    }
+    if (!m_db.commit()) {
+        qDebug() << "트랜잭션 커밋 실패:" << m_db.lastError().text();
+        m_db.rollback();
+        loadSimilarityIndex();
+        return false;
+    }
+    return true;
+}
+
+void DatabaseManager::refreshSimilarity(const QList<int> &ids) {
+    // 다른 프로세스가 바꾼 항목만 색인에 반영 (Apply only the items another process changed)
+    QSqlQuery query;
+    query.prepare("SELECT simhash, COALESCE(group_id, id) FROM clipboard_history WHERE id = :id");
+    for (int id : ids) {
+        query.bindValue(":id", id);
+        if (query.exec() && query.next() && query.value(0).toLongLong() != 0) {
+            m_similar.insert(id, static_cast<quint64>(query.value(0).toLongLong()), query.value(1).toInt());
+        } else {
+            m_similar.remove(id);
+        }
+    }
+}
+
+int DatabaseManager::mergeRecord(QSqlQuery &update, QSqlQuery &insert, const HistoryRecord &record) {
+    const qint64 hash = contentHash(record.content);
+    const QVariant ts = record.timestamp.isEmpty() ? QVariant() : QVariant(record.timestamp);
+    const int pinned = record.isPinned ? 1 : 0;
+    const QVariant tags = record.tags.isEmpty() ? QVariant() : QVariant(record.tags.join(","));
+
+    update.bindValue(":ts", ts);
+    update.bindValue(":pinned", pinned);
+    update.bindValue(":tags", tags);
+    update.bindValue(":hash", hash);
+    update.bindValue(":content", record.content);
+    if (!update.exec()) {
+        qDebug() << "데이터 병합 실패:" << update.lastError().text();
+        return -1;
+    }
+    if (update.numRowsAffected() > 0) {
+        return 0;
+    }
+
+    insert.bindValue(":content", record.content);
+    insert.bindValue(":ts", ts);
+    insert.bindValue(":pinned", pinned);
+    insert.bindValue(":type", record.type.isEmpty() ? QString("text") : record.type);
+    insert.bindValue(":hash", hash);
+    insert.bindValue(":tags", tags);
+    insert.bindValue(":expires", record.expiresAt.isEmpty() ? QVariant() : QVariant(record.expiresAt));
+
+    // 새 항목만 유사 그룹을 찾음, 그룹이 없으면 NULL = 자기 자신 (Only new rows look up a group; NULL means its own)
+    const quint64 simhash = TextProcessor::simHash(record.content);
+    const int group = simhash ? m_similar.findGroup(simhash) : -1;
+    insert.bindValue(":simhash", static_cast<qint64>(simhash));
+    insert.bindValue(":group", group >= 0 ? QVariant(group) : QVariant());
+    if (!insert.exec()) {
+        qDebug() << "데이터 저장 실패:" << insert.lastError().text();
+        return -1;
+    }
+    if (simhash) {
+        const int id = insert.lastInsertId().toInt();
+        m_similar.insert(id, simhash, group >= 0 ? group : id);
+    }
+    return 1;
+}
+
+bool DatabaseManager::saveItem(const QString &content, const QString &type, const QStringList &tags, int ttlSeconds) {
+    QSqlQuery update;
+    QSqlQuery insert;
+    update.prepare(kMergeSql);
+    insert.prepare(kInsertSql);
 
+    HistoryRecord record;
+    record.content = content;
+    record.type = type;
+    if (!beginLocalWrite()) {
+        return false;
+    }
+    if (mergeRecord(update, insert, record) < 0) {
+        update.finish();
+        insert.finish();
+        m_db.rollback();
+        loadSimilarityIndex();
+        return false;
+    }
+    update.finish();
+    insert.finish();
+    if (tags.isEmpty() && ttlSeconds <= 0) {
+        return commitLocalWrite();
+    }
+
+    // 캡처 규칙 결과 반영 (Apply capture-rule results)
+    QSqlQuery query;
+    query.prepare("UPDATE clipboard_history SET tags = COALESCE(:tags, tags), expires_at = COALESCE(:expires, expires_at) "
+                  "WHERE content_hash = :hash AND content = :content");
+    query.bindValue(":tags", tags.isEmpty() ? QVariant() : QVariant(tags.join(",")));
+    query.bindValue(":expires", ttlSeconds > 0
+                    ? QVariant(QDateTime::currentDateTimeUtc().addSecs(ttlSeconds).toString("yyyy-MM-dd HH:mm:ss"))
+                    : QVariant());
+    query.bindValue(":hash", contentHash(content));
+    query.bindValue(":content", content);
     if (!query.exec()) {
-        qDebug() << "데이터 저장 실패:" << query.lastError().text();
+        qDebug() << "태그/만료 저장 실패:" << query.lastError().text();
+        query.finish();
+        m_db.rollback();
+        loadSimilarityIndex();
+        return false;
+    }
+    query.finish();
+    return commitLocalWrite();
+}
+
+bool DatabaseManager::importRecords(const QList<HistoryRecord> &records, int *inserted) {
+    if (!beginLocalWrite()) {
         return false;
     }
+
+    int added = 0;
+    // 저장 형식이 같으므로 문자열 비교로 만료 여부 판단 (Same stored format, so a string comparison tells expiry)
+    const QString now = QDateTime::currentDateTimeUtc().toString("yyyy-MM-dd HH:mm:ss");
+    {
+        // 배치 전체에서 준비된 쿼리를 재사용 (Reuse prepared statements across the batch)
+        QSqlQuery update;
+        QSqlQuery insert;
+        update.prepare(kMergeSql);
+        insert.prepare(kInsertSql);
+
+        for (const HistoryRecord &record : records) {
+            if (record.content.isEmpty()) continue;
+            if (!record.expiresAt.isEmpty() && record.expiresAt <= now) continue;
+            int result = mergeRecord(update, insert, record);
+            if (result < 0) {
+                update.finish();
+                insert.finish();
+                m_db.rollback();
+                loadSimilarityIndex();
+                return false;
+            }
+            added += result;
+        }
+    }
+
+    if (!commitLocalWrite()) {
+        loadSimilarityIndex();
+        return false;
+    }
+    pruneChangeLog();
+    if (inserted) *inserted = added;
+    return true;
+}
+
+bool DatabaseManager::forEachRecord(const std::function<bool(const HistoryRecord &)> &visitor) {
+    QSqlQuery query;
+    query.setForwardOnly(true);
+    if (!query.exec("SELECT content, type, timestamp, is_pinned, tags, expires_at FROM clipboard_history ORDER BY id")) {
+        qDebug() << "히스토리 조회 실패:" << query.lastError().text();
+        return false;
+    }
+
+    HistoryRecord record;
+    while (query.next()) {
+        record.content = query.value(0).toString();
+        record.type = query.value(1).toString();
+        record.timestamp = query.value(2).toString();
+        record.isPinned = query.value(3).toBool();
+        record.tags = query.value(4).toString().split(',', Qt::SkipEmptyParts);
+        record.expiresAt = query.value(5).toString();
+        if (!visitor(record)) break;
+    }
     return true;
 }
 
 QList<ClipboardItem> DatabaseManager::getAllItems() {
     QList<ClipboardItem> items;
-    QSqlQuery query("SELECT id, content, timestamp, is_pinned, type FROM clipboard_history ORDER BY is_pinned DESC, timestamp DESC");
+    QSqlQuery query("SELECT id, content, timestamp, is_pinned, type, tags, COALESCE(group_id, id) FROM clipboard_history ORDER BY is_pinned DESC, timestamp DESC");
     
     while (query.next()) {
         ClipboardItem item;
@@ -57,6 +612,8 @@ QList<ClipboardItem> DatabaseManager::getAllItems() {
         item.timestamp = query.value(2).toDateTime();
         item.isPinned = query.value(3).toBool();
         item.type = query.value(4).toString();
+        item.tags = query.value(5).toString().split(',', Qt::SkipEmptyParts);
+        item.groupId = query.value(6).toInt();
         items.append(item);
     }
     return items;
@@ -66,7 +623,19 @@ bool DatabaseManager::deleteItem(int id) {
     QSqlQuery query;
     query.prepare("DELETE FROM clipboard_history WHERE id = :id");
     query.bindValue(":id", id);
-    return query.exec();
+    if (!beginLocalWrite()) {
+        return false;
+    }
+    if (!query.exec()) {
+        m_db.rollback();
+        return false;
+    }
+    query.finish();
+    if (!commitLocalWrite()) {
+        return false;
+    }
+    m_similar.remove(id);
+    return true;
 }
 
 bool DatabaseManager::togglePin(int id, bool pinned) {
@@ -74,13 +643,21 @@ bool DatabaseManager::togglePin(int id, bool pinned) {
     query.prepare("UPDATE clipboard_history SET is_pinned = :pinned WHERE id = :id");
     query.bindValue(":pinned", pinned ? 1 : 0);
     query.bindValue(":id", id);
-    return query.exec();
+    if (!beginLocalWrite()) {
+        return false;
+    }
+    if (!query.exec()) {
+        m_db.rollback();
+        return false;
+    }
+    query.finish();
+    return commitLocalWrite();
 }
 
 QList<ClipboardItem> DatabaseManager::searchItems(const QString &searchQuery) {
     QList<ClipboardItem> items;
     QSqlQuery query;
-    query.prepare("SELECT id, content, timestamp, is_pinned, type FROM clipboard_history "
+    query.prepare("SELECT id, content, timestamp, is_pinned, type, tags, COALESCE(group_id, id) FROM clipboard_history "
                   "WHERE content LIKE :query ORDER BY is_pinned DESC, timestamp DESC");
     query.bindValue(":query", "%" + searchQuery + "%");
     
@@ -92,6 +669,8 @@ QList<ClipboardItem> DatabaseManager::searchItems(const QString &searchQuery) {
             item.timestamp = query.value(2).toDateTime();
             item.isPinned = query.value(3).toBool();
             item.type = query.value(4).toString();
+            item.tags = query.value(5).toString().split(',', Qt::SkipEmptyParts);
+            item.groupId = query.value(6).toInt();
             items.append(item);
         }
     }
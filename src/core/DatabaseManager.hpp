@@ -17,7 +17,12 @@
 #include <QSqlQuery>
 #include <QSqlError>
 #include <QDateTime>
+#include <QStringList>
+#include <QPair>
 #include <QDebug>
+#include <QTimer>
+#include <functional>
+#include "NearDuplicateIndex.hpp"
 
 /**
  * @struct ClipboardItem
@@ -29,6 +34,24 @@ struct ClipboardItem {
     QDateTime timestamp;    ///< 복사된 시간 (Time of copy)
     bool isPinned;          ///< 고정 여부 (Whether it is pinned)
     QString type;           ///< 데이터 타입 (Data type: Text, JSON, etc.)
+    QStringList tags;       ///< 캡처 규칙이 붙인 태그 (Tags attached by capture rules)
+    int groupId;            ///< 유사 항목 그룹 ID (Near-duplicate group ID)
+};
+
+/**
+ * @struct HistoryRecord
+ * @brief 가져오기/내보내기용 원본 행 (Raw row used by import/export)
+ *
+ * 타임스탬프는 DB에 저장된 "yyyy-MM-dd HH:mm:ss" (UTC) 문자열 그대로 유지합니다.
+ * The timestamp is kept as the stored "yyyy-MM-dd HH:mm:ss" (UTC) string.
+ */
+struct HistoryRecord {
+    QString content;        ///< 복사된 내용 (Copied content)
+    QString type;           ///< 데이터 타입 (Data type)
+    QString timestamp;      ///< 저장된 시간 문자열, 비어 있으면 현재 시간 (Stored time string, empty means now)
+    bool isPinned = false;  ///< 고정 여부 (Whether it is pinned)
+    QStringList tags;       ///< 캡처 규칙이 붙인 태그 (Tags attached by capture rules)
+    QString expiresAt;      ///< 만료 시간 문자열, 비어 있으면 만료 없음 (Expiry time string, empty for none)
 };
 
 /**
@@ -43,17 +66,46 @@ public:
 
     /**
      * @brief 데이터베이스 초기화 및 테이블 생성 (Initialize database and create tables)
+     *
+     * 모든 프로세스가 같은 사용자별 DB 파일을 WAL 모드로 공유합니다.
+     * Every process shares the same per-user database file in WAL mode.
      * @return 성공 여부 (Success or failure)
      */
     bool init();
 
+    /**
+     * @brief 사용자별 데이터베이스 파일 경로 (Per-user database file path)
+     *
+     * CLIPSMITH_DB_PATH 환경 변수가 있으면 그 경로를 사용합니다.
+     * The CLIPSMITH_DB_PATH environment variable overrides the default location.
+     * @return 절대 경로 (Absolute path)
+     */
+    static QString databasePath();
+
+    /**
+     * @brief 다른 프로세스의 변경 감시 시작 (Start watching for changes made by other processes)
+     * @param intervalMs 폴링 간격 (Polling interval in milliseconds)
+     */
+    void startWatching(int intervalMs = 500);
+
+    /**
+     * @brief ID로 항목 하나 가져오기 (Retrieve a single item by ID)
+     * @param id 항목 ID (Item ID)
+     * @param item 결과를 받을 구조체 (Receives the item)
+     * @return 항목이 존재하면 true (True if the item exists)
+     */
+    bool getItem(int id, ClipboardItem *item);
+
     /**
      * @brief 새로운 클립보드 항목 저장 (Save a new clipboard item)
      * @param content 내용 (Content)
      * @param type 타입 (Type)
+     * @param tags 태그 (Tags)
+     * @param ttlSeconds 만료까지 남은 시간, 0이면 만료 없음 (Seconds until expiry, 0 for none)
      * @return 성공 여부 (Success or failure)
      */
-    bool saveItem(const QString &content, const QString &type = "text");
+    bool saveItem(const QString &content, const QString &type = "text",
+                  const QStringList &tags = QStringList(), int ttlSeconds = 0);
 
     /**
      * @brief 모든 히스토리 항목 가져오기 (Retreive all history items)
@@ -83,8 +135,127 @@ public:
      */
     QList<ClipboardItem> searchItems(const QString &query);
 
+    /**
+     * @brief 여러 행을 하나의 트랜잭션으로 병합 (Merge many rows in a single transaction)
+     *
+     * 캡처와 동일한 중복 규칙을 적용합니다: 같은 내용이 이미 있으면 새 행을 만들지 않고
+     * 더 최근 시간과 고정 상태만 반영합니다.
+     * Applies the same dedup rule as capture: an existing identical content only
+     * takes the newer timestamp and pin state instead of creating a new row.
+     * 이미 만료된 행은 건너뛰고, 기존 행에 태그가 없을 때만 가져온 태그를 씁니다.
+     * Rows that have already expired are skipped, and imported tags apply only to rows without tags.
+     * @param records 병합할 행들 (Rows to merge)
+     * @param inserted 새로 추가된 행 수 (Number of newly inserted rows, optional)
+     * @return 성공 여부 (Success or failure)
+     */
+    bool importRecords(const QList<HistoryRecord> &records, int *inserted = nullptr);
+
+    /**
+     * @brief 전체 히스토리를 한 행씩 순회 (Stream the whole history row by row)
+     *
+     * 전방 전용 커서를 사용하므로 메모리 사용량이 히스토리 크기와 무관합니다.
+     * Uses a forward-only cursor so memory use does not grow with the history size.
+     * @param visitor 각 행에 대해 호출, false 반환 시 중단 (Called per row, return false to stop)
+     * @return 성공 여부 (Success or failure)
+     */
+    bool forEachRecord(const std::function<bool(const HistoryRecord &)> &visitor);
+
+    /**
+     * @brief 중복 검사용 내용 해시 (Content hash used for dedup lookups)
+     * @param content 내용 (Content)
+     * @return 64비트 FNV-1a 해시 (64-bit FNV-1a hash)
+     */
+    static qint64 contentHash(const QString &content);
+
+signals:
+    /**
+     * @brief 다른 프로세스가 항목을 추가/수정/삭제했을 때 발생 (Emitted when another process added, changed or deleted items)
+     * @param ids 변경된 항목 ID 목록, 삭제된 ID 포함 (Changed item IDs, including deleted ones)
+     */
+    void itemsChanged(const QList<int> &ids);
+
+    /**
+     * @brief 이 프로세스가 만료된 항목을 삭제했을 때 발생 (Emitted when this process deleted expired items)
+     * @param ids 삭제된 항목 ID 목록 (Deleted item IDs)
+     */
+    void itemsExpired(const QList<int> &ids);
+
+    /**
+     * @brief 변경 내역을 따라갈 수 없어 전체 갱신이 필요할 때 발생 (Emitted when changes cannot be followed and a full reload is needed)
+     */
+    void historyReset();
+
+private slots:
+    /**
+     * @brief data_version을 확인하고 새 변경 내역을 전달 (Check data_version and deliver new change-log entries)
+     */
+    void pollChanges();
+
+    /**
+     * @brief 만료된 항목 삭제 (Delete expired items)
+     */
+    void purgeExpired();
+
 private:
+    /**
+     * @brief 이전 버전 테이블에 누락된 컬럼과 인덱스 추가 (Add columns and indexes missing from older tables)
+     * @return 성공 여부 (Success or failure)
+     */
+    bool migrateSchema();
+
+    /**
+     * @brief 중복 규칙에 따라 한 행을 갱신 또는 추가 (Update or insert one row following the dedup rule)
+     * @return 새 행이 추가되면 1, 기존 행이 갱신되면 0, 실패 시 -1 (1 if inserted, 0 if merged, -1 on failure)
+     */
+    int mergeRecord(QSqlQuery &update, QSqlQuery &insert, const HistoryRecord &record);
+
+    /**
+     * @brief DB에 저장된 지문으로 유사 색인 재구성 (Rebuild the similarity index from stored fingerprints)
+     */
+    void loadSimilarityIndex();
+
+    /**
+     * @brief 지문이 없는 이전 행에 지문과 그룹 부여 (Fingerprint and group rows written by older versions)
+     * @return 성공 여부, 실패하면 롤백하고 색인을 다시 읽음 (Success; on failure rolls back and reloads the index)
+     */
+    bool backfillSimilarity();
+
+    /**
+     * @brief 지정한 항목만 유사 색인에 다시 반영 (Re-sync only the given items in the similarity index)
+     * @param ids 항목 ID 목록 (Item IDs)
+     */
+    void refreshSimilarity(const QList<int> &ids);
+
+    /**
+     * @brief 최근 변경 기록만 남기고 정리 (Trim the change log to its most recent entries)
+     */
+    void pruneChangeLog();
+
+    /**
+     * @brief 자기 쓰기 트랜잭션 시작 (Begin a local write transaction)
+     *
+     * 자기 연결의 커밋은 data_version을 바꾸지 않아 폴링이 자기 변경을 다시 읽게 되므로, 쓰기 잠금을 먼저 잡고
+     * 그 안에서 생긴 변경 순번 구간을 기억해 두었다가 폴링에서 건너뜁니다.
+     * Own commits do not move data_version, so polling would replay them as foreign changes. The write lock is
+     * taken up front and the change-log range produced inside it is remembered so polling can skip it.
+     * @return 성공 여부 (Success or failure)
+     */
+    bool beginLocalWrite();
+
+    /**
+     * @brief 자기 쓰기 트랜잭션 커밋 후 변경 순번 구간 기록 (Commit a local write and record its change-log range)
+     * @return 성공 여부, 실패하면 롤백됨 (Success or failure; rolled back on failure)
+     */
+    bool commitLocalWrite();
+
     QSqlDatabase m_db; ///< SQLite 데이터베이스 인스턴스 (SQLite Database Instance)
+    QTimer *m_watchTimer = nullptr; ///< 변경 감시 타이머 (Change polling timer)
+    QTimer *m_expiryTimer = nullptr; ///< 만료 정리 타이머 (Expiry purge timer)
+    qint64 m_dataVersion = -1;      ///< 마지막으로 본 PRAGMA data_version (Last seen PRAGMA data_version)
+    qint64 m_lastChangeSeq = 0;     ///< 마지막으로 처리한 변경 순번 (Last processed change-log sequence)
+    qint64 m_writeStartSeq = 0;     ///< 진행 중인 자기 쓰기 직전의 변경 순번 (Change sequence before the running local write)
+    QList<QPair<qint64, qint64>> m_ownChanges; ///< 아직 폴링되지 않은 자기 변경 구간 (first, last] (Unpolled own ranges)
+    NearDuplicateIndex m_similar;   ///< 유사 중복 LSH 색인 (Near-duplicate LSH index)
 };
 
 #endif // DATABASEMANAGER_HPP
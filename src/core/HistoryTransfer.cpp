@@ -0,0 +1,171 @@
+#include "HistoryTransfer.hpp"
+#include <QFile>
+#include <QFileInfo>
+#include <QDataStream>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+
+namespace {
+const quint32 kBinaryMagic = 0x434C5348;  // "CLSH"
+// 2: 태그와 만료 시간 추가 (2: adds tags and expiry)
+const quint16 kBinaryVersion = 2;
+const QString kTimestampFormat = QStringLiteral("yyyy-MM-dd HH:mm:ss");
+
+// 외부 파일의 시간을 DB 저장 형식(UTC)으로 맞춤 (Normalize external timestamps to the stored UTC form)
+QString normalizeTimestamp(const QString &value) {
+    if (value.isEmpty()) return QString();
+    QDateTime dt = QDateTime::fromString(value, kTimestampFormat);
+    if (dt.isValid()) return value;
+    dt = QDateTime::fromString(value, Qt::ISODate);
+    if (!dt.isValid()) return QString();
+    return dt.toUTC().toString(kTimestampFormat);
+}
+}
+
+TransferFormat HistoryTransfer::resolveFormat(const QString &path, TransferFormat format) {
+    if (format != TransferFormat::Auto) return format;
+    const QString suffix = QFileInfo(path).suffix().toLower();
+    if (suffix == "jsonl" || suffix == "ndjson" || suffix == "json") {
+        return TransferFormat::JsonLines;
+    }
+    return TransferFormat::Binary;
+}
+
+qint64 HistoryTransfer::exportHistory(DatabaseManager *db, const QString &path, TransferFormat format) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << "내보내기 파일 열기 실패:" << file.errorString();
+        return -1;
+    }
+
+    qint64 count = 0;
+    bool ok = false;
+    if (resolveFormat(path, format) == TransferFormat::JsonLines) {
+        ok = db->forEachRecord([&](const HistoryRecord &record) {
+            QJsonObject obj;
+            obj.insert("content", record.content);
+            obj.insert("type", record.type);
+            obj.insert("timestamp", record.timestamp);
+            obj.insert("pinned", record.isPinned);
+            if (!record.tags.isEmpty()) obj.insert("tags", QJsonArray::fromStringList(record.tags));
+            if (!record.expiresAt.isEmpty()) obj.insert("expiresAt", record.expiresAt);
+            QByteArray line = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+            line.append('\n');
+            if (file.write(line) != line.size()) return false;
+            ++count;
+            return true;
+        });
+    } else {
+        QDataStream out(&file);
+        out.setVersion(QDataStream::Qt_5_0);
+        out << kBinaryMagic << kBinaryVersion;
+        ok = db->forEachRecord([&](const HistoryRecord &record) {
+            out << quint8(record.isPinned ? 1 : 0)
+                << record.timestamp.toUtf8()
+                << record.type.toUtf8()
+                << record.content.toUtf8()
+                << record.tags.join(",").toUtf8()
+                << record.expiresAt.toUtf8();
+            if (out.status() != QDataStream::Ok) return false;
+            ++count;
+            return true;
+        });
+    }
+
+    if (!ok || file.error() != QFileDevice::NoError) {
+        qDebug() << "내보내기 실패:" << file.errorString();
+        return -1;
+    }
+    return count;
+}
+
+qint64 HistoryTransfer::importHistory(DatabaseManager *db, const QString &path, TransferFormat format) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "가져오기 파일 열기 실패:" << file.errorString();
+        return -1;
+    }
+
+    qint64 total = 0;
+    QList<HistoryRecord> batch;
+    batch.reserve(kBatchSize);
+
+    // 배치가 차면 한 번의 트랜잭션으로 반영 (Flush each full batch as one transaction)
+    auto flush = [&]() {
+        if (batch.isEmpty()) return true;
+        int inserted = 0;
+        if (!db->importRecords(batch, &inserted)) return false;
+        total += inserted;
+        batch.clear();
+        return true;
+    };
+
+    if (resolveFormat(path, format) == TransferFormat::JsonLines) {
+        qint64 lineNo = 0;
+        while (!file.atEnd()) {
+            const QByteArray line = file.readLine().trimmed();
+            ++lineNo;
+            if (line.isEmpty()) continue;
+
+            QJsonParseError error;
+            const QJsonDocument doc = QJsonDocument::fromJson(line, &error);
+            if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+                qDebug() << "잘못된 JSON 줄 건너뜀 (Skipping invalid line):" << lineNo;
+                continue;
+            }
+
+            const QJsonObject obj = doc.object();
+            HistoryRecord record;
+            record.content = obj.value("content").toString();
+            record.type = obj.value("type").toString();
+            record.timestamp = normalizeTimestamp(obj.value("timestamp").toString());
+            record.isPinned = obj.value("pinned").toBool();
+            for (const QJsonValue &tag : obj.value("tags").toArray()) {
+                if (!tag.toString().isEmpty()) record.tags.append(tag.toString());
+            }
+            record.expiresAt = normalizeTimestamp(obj.value("expiresAt").toString());
+            batch.append(record);
+
+            if (batch.size() >= kBatchSize && !flush()) return -1;
+        }
+    } else {
+        QDataStream in(&file);
+        in.setVersion(QDataStream::Qt_5_0);
+        quint32 magic = 0;
+        quint16 version = 0;
+        in >> magic >> version;
+        if (magic != kBinaryMagic || version < 1 || version > kBinaryVersion) {
+            qDebug() << "지원하지 않는 파일 형식입니다. (Unsupported file format)";
+            return -1;
+        }
+
+        while (!in.atEnd()) {
+            quint8 flags = 0;
+            QByteArray timestamp, type, content, tags, expiresAt;
+            in >> flags >> timestamp >> type >> content;
+            if (version >= 2) in >> tags >> expiresAt;
+            if (in.status() != QDataStream::Ok) {
+                // 앞선 배치는 이미 커밋되었으므로 그 수를 함께 알림 (Earlier batches are already committed, so report them)
+                qDebug() << "손상되었거나 잘린 파일, 가져오기 중단 (Corrupt or truncated file, import aborted):"
+                         << total << "rows already imported";
+                return -1;
+            }
+
+            HistoryRecord record;
+            record.content = QString::fromUtf8(content);
+            record.type = QString::fromUtf8(type);
+            record.timestamp = normalizeTimestamp(QString::fromUtf8(timestamp));
+            record.isPinned = flags & 1;
+            record.tags = QString::fromUtf8(tags).split(',', Qt::SkipEmptyParts);
+            record.expiresAt = normalizeTimestamp(QString::fromUtf8(expiresAt));
+            batch.append(record);
+
+            if (batch.size() >= kBatchSize && !flush()) return -1;
+        }
+    }
+
+    if (!flush()) return -1;
+    return total;
+}
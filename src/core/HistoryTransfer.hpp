@@ -0,0 +1,72 @@
+/**
+ * @file HistoryTransfer.hpp
+ * @brief 히스토리 가져오기/내보내기 클래스 (History Import/Export Class)
+ *
+ * 히스토리를 JSON Lines 또는 길이 접두 바이너리 형식으로 스트리밍 처리합니다.
+ * Streams history to and from JSON Lines or a length-prefixed binary format.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef HISTORYTRANSFER_HPP
+#define HISTORYTRANSFER_HPP
+
+#include <QString>
+#include "DatabaseManager.hpp"
+
+/**
+ * @enum TransferFormat
+ * @brief 가져오기/내보내기 파일 형식 (Import/export file format)
+ */
+enum class TransferFormat {
+    Auto,       ///< 확장자로 판단 (Decide by file extension)
+    JsonLines,  ///< 한 줄에 하나의 JSON 객체 (One JSON object per line)
+    Binary      ///< 길이 접두 바이너리 (Length-prefixed binary)
+};
+
+/**
+ * @class HistoryTransfer
+ * @brief 히스토리 스트리밍 전송 엔진 (History Streaming Transfer Engine)
+ *
+ * 행을 고정 크기 배치로 읽고 써서 히스토리 크기와 무관하게 메모리 사용량을 유지합니다.
+ * Reads and writes rows in fixed-size batches so memory use stays flat regardless of history size.
+ */
+class HistoryTransfer {
+public:
+    /**
+     * @brief 히스토리를 파일로 내보내기 (Export history to a file)
+     * @param db 데이터베이스 관리자 (Database manager)
+     * @param path 대상 파일 경로 (Target file path)
+     * @param format 파일 형식 (File format)
+     * @return 내보낸 행 수, 실패 시 -1 (Number of exported rows, -1 on failure)
+     */
+    static qint64 exportHistory(DatabaseManager *db, const QString &path, TransferFormat format = TransferFormat::Auto);
+
+    /**
+     * @brief 파일에서 히스토리 가져오기 (Import history from a file)
+     *
+     * 캡처와 같은 중복 규칙으로 병합되며, 배치마다 하나의 트랜잭션을 사용합니다.
+     * 바이너리 파일이 손상되었거나 잘렸으면 -1을 반환하며, 그 전에 커밋된 배치는 남습니다.
+     * Rows are merged with the capture dedup rule, one transaction per batch.
+     * A corrupt or truncated binary file returns -1; batches committed before the damage remain.
+     * @param db 데이터베이스 관리자 (Database manager)
+     * @param path 원본 파일 경로 (Source file path)
+     * @param format 파일 형식 (File format)
+     * @return 새로 추가된 행 수, 실패 시 -1 (Number of newly added rows, -1 on failure)
+     */
+    static qint64 importHistory(DatabaseManager *db, const QString &path, TransferFormat format = TransferFormat::Auto);
+
+    /**
+     * @brief 경로 확장자로 형식 결정 (Resolve the format from a path extension)
+     * @param path 파일 경로 (File path)
+     * @param format 요청된 형식 (Requested format)
+     * @return Auto가 아닌 실제 형식 (Concrete, non-Auto format)
+     */
+    static TransferFormat resolveFormat(const QString &path, TransferFormat format);
+
+private:
+    static constexpr int kBatchSize = 5000;  ///< 트랜잭션당 행 수 (Rows per transaction)
+};
+
+#endif // HISTORYTRANSFER_HPP
@@ -0,0 +1,84 @@
+#include "NearDuplicateIndex.hpp"
+#include <QtAlgorithms>
+
+namespace {
+// 흔한 밴드 값은 최근 항목만 확인 (Only the newest entries of a crowded bucket are checked)
+const int kMaxBucketScan = 256;
+// 빈 자리가 이보다 많고 남은 항목보다 많으면 압축 (Compact once holes exceed this and the live count)
+const int kMinCompactHoles = 32;
+}
+
+quint32 NearDuplicateIndex::bandKey(quint64 hash, int band) {
+    return (quint32(band) << 16) | quint32((hash >> (16 * band)) & 0xFFFF);
+}
+
+int NearDuplicateIndex::findGroup(quint64 hash) const {
+    int bestGroup = -1;
+    int bestDistance = kMaxDistance + 1;
+    for (int band = 0; band < kBands && bestDistance > 0; ++band) {
+        auto bucket = m_buckets.constFind(bandKey(hash, band));
+        if (bucket == m_buckets.constEnd()) continue;
+
+        const QVector<int> &ids = bucket->ids;
+        int scanned = 0;
+        for (int i = static_cast<int>(ids.size()) - 1; i >= 0 && scanned < kMaxBucketScan; --i) {
+            if (ids[i] < 0) continue;
+            ++scanned;
+            const Entry entry = m_entries.value(ids[i]);
+            const int distance = qPopulationCount(hash ^ entry.hash);
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                bestGroup = entry.group;
+            }
+        }
+    }
+    return bestGroup;
+}
+
+void NearDuplicateIndex::insert(int id, quint64 hash, int group) {
+    if (m_entries.contains(id)) remove(id);
+    Entry entry;
+    entry.hash = hash;
+    entry.group = group;
+    for (int band = 0; band < kBands; ++band) {
+        Bucket &bucket = m_buckets[bandKey(hash, band)];
+        entry.slot[band] = static_cast<int>(bucket.ids.size());
+        bucket.ids.append(id);
+        ++bucket.live;
+    }
+    m_entries.insert(id, entry);
+}
+
+void NearDuplicateIndex::remove(int id) {
+    auto entry = m_entries.find(id);
+    if (entry == m_entries.end()) return;
+    const Entry removed = entry.value();
+    m_entries.erase(entry);
+    for (int band = 0; band < kBands; ++band) {
+        auto bucket = m_buckets.find(bandKey(removed.hash, band));
+        if (bucket == m_buckets.end()) continue;
+        bucket->ids[removed.slot[band]] = -1;
+        if (--bucket->live == 0) {
+            m_buckets.erase(bucket);
+            continue;
+        }
+        const int holes = static_cast<int>(bucket->ids.size()) - bucket->live;
+        if (holes >= kMinCompactHoles && holes > bucket->live) compact(*bucket, band);
+    }
+}
+
+void NearDuplicateIndex::compact(Bucket &bucket, int band) {
+    // 순서를 유지한 채 빈 자리를 없애고 옮겨진 항목의 위치를 갱신 (Drop holes in order and update moved positions)
+    int out = 0;
+    for (int id : bucket.ids) {
+        if (id < 0) continue;
+        m_entries[id].slot[band] = out;
+        bucket.ids[out++] = id;
+    }
+    bucket.ids.resize(out);
+}
+
+void NearDuplicateIndex::clear() {
+    m_entries.clear();
+    m_buckets.clear();
+}
@@ -0,0 +1,81 @@
+/**
+ * @file NearDuplicateIndex.hpp
+ * @brief SimHash 유사 중복 색인 클래스 (SimHash Near-Duplicate Index Class)
+ *
+ * 64비트 SimHash를 16비트 밴드 4개로 나눈 LSH 색인으로 유사 항목 후보를 빠르게 찾습니다.
+ * Finds near-duplicate candidates quickly with an LSH index over four 16-bit bands of a 64-bit SimHash.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef NEARDUPLICATEINDEX_HPP
+#define NEARDUPLICATEINDEX_HPP
+
+#include <QHash>
+#include <QVector>
+
+/**
+ * @class NearDuplicateIndex
+ * @brief 유사 중복 그룹 색인 (Near-Duplicate Group Index)
+ *
+ * 해밍 거리가 3 이하인 두 지문은 비둘기집 원리에 따라 적어도 한 밴드가 같으므로 같은 밴드 버킷만
+ * 확인하면 됩니다. 다만 흔한 밴드 값의 버킷은 최근 256개만 확인하므로 그보다 오래된 유사 항목은
+ * 놓칠 수 있습니다. 제거는 자리를 비워 두고 나중에 한꺼번에 압축하므로 버킷 크기와 무관합니다.
+ * Two fingerprints within Hamming distance 3 share at least one band by the pigeonhole principle, so
+ * only same-band buckets need checking. Crowded buckets are scanned only for their newest 256 entries,
+ * though, so an older similar item can be missed. Removal leaves a hole that is compacted later, so it
+ * does not depend on the bucket size.
+ */
+class NearDuplicateIndex {
+public:
+    static constexpr int kMaxDistance = 3; ///< 유사로 판단할 최대 해밍 거리 (Maximum Hamming distance treated as similar)
+
+    /**
+     * @brief 가장 가까운 유사 항목의 그룹 찾기 (Find the group of the closest similar item)
+     * @param hash SimHash 지문 (SimHash fingerprint)
+     * @return 그룹 ID, 없으면 -1 (Group ID, -1 if none)
+     */
+    int findGroup(quint64 hash) const;
+
+    /**
+     * @brief 항목 추가 또는 갱신 (Insert or update an item)
+     * @param id 항목 ID (Item ID)
+     * @param hash SimHash 지문 (SimHash fingerprint)
+     * @param group 그룹 ID (Group ID)
+     */
+    void insert(int id, quint64 hash, int group);
+
+    /**
+     * @brief 항목 제거 (Remove an item)
+     * @param id 항목 ID (Item ID)
+     */
+    void remove(int id);
+
+    /**
+     * @brief 모든 항목 제거 (Remove every item)
+     */
+    void clear();
+
+private:
+    static constexpr int kBands = 4;
+
+    struct Entry {
+        quint64 hash;
+        int group;
+        int slot[kBands];  ///< 밴드별 버킷 안의 위치 (Position inside each band's bucket)
+    };
+
+    struct Bucket {
+        QVector<int> ids;  ///< 추가 순서의 항목 ID, 제거된 자리는 -1 (Item IDs in insertion order, -1 for removed)
+        int live = 0;      ///< 남아 있는 항목 수 (Number of remaining items)
+    };
+
+    static quint32 bandKey(quint64 hash, int band);
+    void compact(Bucket &bucket, int band);
+
+    QHash<int, Entry> m_entries;       ///< 항목 ID별 지문 (Fingerprint per item ID)
+    QHash<quint32, Bucket> m_buckets;  ///< 밴드 값별 항목 ID (Item IDs per band value)
+};
+
+#endif // NEARDUPLICATEINDEX_HPP
@@ -0,0 +1,718 @@
+#include "PatternAutomaton.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iterator>
+
+namespace {
+// DFA 캐시 상한, 넘으면 비우고 다시 생성 (DFA cache cap; flushed and rebuilt when exceeded)
+const size_t kMaxDfaStates = 4096;
+// 패턴 하나가 만들 수 있는 NFA 상태 상한 (Upper bound of NFA states per pattern)
+const size_t kMaxNfaStatesPerPattern = 20000;
+const int kMaxRepeat = 1000;
+
+inline unsigned char foldByte(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+}
+
+// UTF-8 다중 바이트 시퀀스의 길이, 선행 바이트가 아니면 0 (Length of a UTF-8 multi-byte sequence, 0 if not a lead byte)
+inline size_t utf8Length(unsigned char c) {
+    if (c >= 0xC2 && c <= 0xDF) return 2;
+    if (c >= 0xE0 && c <= 0xEF) return 3;
+    if (c >= 0xF0 && c <= 0xF4) return 4;
+    return 0;
+}
+
+// QRegularExpression은 UTF 모드에서 k/s를 켈빈 기호(U+212A)와 긴 s(U+017F)와도 대소문자 무시로 맞춥니다
+// In UTF mode QRegularExpression also case-folds k/s to the Kelvin sign (U+212A) and long s (U+017F)
+inline bool hasNonAsciiFold(const std::string &text) {
+    return text.find_first_of("kKsS") != std::string::npos;
+}
+
+inline bool isAscii(const std::string &text) {
+    return std::all_of(text.begin(), text.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+}
+}
+
+// 정규식 부분 문법 재귀 하강 파서 (Recursive-descent parser for the supported regex subset)
+class PatternAutomaton::Parser {
+public:
+    Parser(const std::string &pattern, bool ignoreCase, std::vector<Node> &nodes)
+        : m_src(pattern), m_ignoreCase(ignoreCase), m_nodes(nodes) {}
+
+    int parse(std::string &error) {
+        int root = parseAlt();
+        if (m_error.empty() && m_pos < m_src.size()) fail("unmatched ')'");
+        error = m_error;
+        return m_error.empty() ? root : -1;
+    }
+
+private:
+    bool atEnd() const { return m_pos >= m_src.size(); }
+    unsigned char peek() const { return static_cast<unsigned char>(m_src[m_pos]); }
+    unsigned char next() { return static_cast<unsigned char>(m_src[m_pos++]); }
+
+    int fail(const std::string &message) {
+        if (m_error.empty()) m_error = message;
+        m_pos = m_src.size();
+        return addEmpty();
+    }
+
+    int addNode(Node node) {
+        m_nodes.push_back(std::move(node));
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+
+    int addEmpty() {
+        Node node;
+        node.kind = Node::Empty;
+        return addNode(node);
+    }
+
+    void fold(ByteSet &set) const {
+        if (!m_ignoreCase) return;
+        for (int c = 'a'; c <= 'z'; ++c) {
+            if (set[c] || set[c - 32]) {
+                set.set(c);
+                set.set(c - 32);
+            }
+        }
+    }
+
+    int addSet(const ByteSet &set) {
+        Node node;
+        node.kind = Node::Set;
+        node.set = set;
+        return addNode(node);
+    }
+
+    int addGroup(Node::Kind kind, std::vector<int> kids) {
+        if (kids.size() == 1) return kids[0];
+        Node node;
+        node.kind = kind;
+        node.kids = std::move(kids);
+        return addNode(node);
+    }
+
+    int addBytes(std::initializer_list<int> bytes) {
+        std::vector<int> kids;
+        for (int b : bytes) {
+            ByteSet set;
+            set.set(b);
+            kids.push_back(addSet(set));
+        }
+        return addGroup(Node::Cat, kids);
+    }
+
+    // 임의의 비ASCII 코드 포인트 하나 (Any single non-ASCII code point)
+    int addNonAscii() {
+        static const int kLeads[3][2] = {{0xC2, 0xDF}, {0xE0, 0xEF}, {0xF0, 0xF4}};
+        ByteSet continuation;
+        for (int c = 0x80; c <= 0xBF; ++c) continuation.set(c);
+        std::vector<int> alts;
+        for (int n = 0; n < 3; ++n) {
+            ByteSet lead;
+            for (int c = kLeads[n][0]; c <= kLeads[n][1]; ++c) lead.set(c);
+            std::vector<int> kids{addSet(lead)};
+            for (int k = 0; k <= n; ++k) kids.push_back(addSet(continuation));
+            alts.push_back(addGroup(Node::Cat, kids));
+        }
+        return addGroup(Node::Alt, alts);
+    }
+
+    // 문자 하나에 매칭되는 노드: ASCII 부분은 바이트 집합, 비ASCII는 코드 포인트 전체를 소비
+    // A node matching one character: the ASCII part is a byte set, non-ASCII consumes a whole code point
+    int addCharClass(ByteSet ascii, bool nonAscii) {
+        fold(ascii);
+        for (int c = 0x80; c < 256; ++c) ascii.reset(c);
+        std::vector<int> alts;
+        if (ascii.any()) alts.push_back(addSet(ascii));
+        if (nonAscii) {
+            alts.push_back(addNonAscii());
+        } else if (m_ignoreCase) {
+            if (ascii['k']) alts.push_back(addBytes({0xE2, 0x84, 0xAA}));
+            if (ascii['s']) alts.push_back(addBytes({0xC5, 0xBF}));
+        }
+        if (alts.empty()) return fail("empty character class");
+        return addGroup(Node::Alt, alts);
+    }
+
+    static ByteSet asciiComplement(const ByteSet &set) {
+        ByteSet result;
+        for (int c = 0; c < 0x80; ++c) {
+            if (!set[c]) result.set(c);
+        }
+        return result;
+    }
+
+    int parseAlt() {
+        std::vector<int> kids{parseCat()};
+        while (!atEnd() && peek() == '|') {
+            next();
+            kids.push_back(parseCat());
+        }
+        if (kids.size() == 1) return kids[0];
+        Node node;
+        node.kind = Node::Alt;
+        node.kids = kids;
+        return addNode(node);
+    }
+
+    int parseCat() {
+        std::vector<int> kids;
+        while (!atEnd() && peek() != '|' && peek() != ')') {
+            kids.push_back(parseRepeat());
+        }
+        if (kids.empty()) return addEmpty();
+        if (kids.size() == 1) return kids[0];
+        Node node;
+        node.kind = Node::Cat;
+        node.kids = kids;
+        return addNode(node);
+    }
+
+    // {m}, {m,}, {m,n} 해석, 형식이 아니면 false (Parse a bound; false if it is not one)
+    bool parseBounds(int &min, int &max) {
+        size_t pos = m_pos + 1;
+        auto readInt = [&](int &value) {
+            size_t begin = pos;
+            value = 0;
+            while (pos < m_src.size() && m_src[pos] >= '0' && m_src[pos] <= '9') {
+                value = std::min(value * 10 + (m_src[pos] - '0'), kMaxRepeat + 1);
+                ++pos;
+            }
+            return pos > begin;
+        };
+        if (!readInt(min)) return false;
+        max = min;
+        if (pos < m_src.size() && m_src[pos] == ',') {
+            ++pos;
+            if (!readInt(max)) max = -1;
+        }
+        if (pos >= m_src.size() || m_src[pos] != '}') return false;
+        m_pos = pos + 1;
+        return true;
+    }
+
+    int parseRepeat() {
+        int atom = parseAtom();
+        while (!atEnd()) {
+            int min = 0;
+            int max = 0;
+            unsigned char c = peek();
+            if (c == '*') { next(); min = 0; max = -1; }
+            else if (c == '+') { next(); min = 1; max = -1; }
+            else if (c == '?') { next(); min = 0; max = 1; }
+            else if (c == '{' && parseBounds(min, max)) {}
+            else break;
+
+            if (min > kMaxRepeat || max > kMaxRepeat) return fail("repeat count too large");
+            if (max >= 0 && max < min) return fail("invalid repeat range");
+            // 게으른 수량자는 매칭 여부에 영향이 없음 (Lazy quantifiers do not change whether a match exists)
+            if (!atEnd() && peek() == '?') next();
+            else if (!atEnd() && peek() == '+') return fail("possessive quantifiers are not supported");
+
+            Node node;
+            node.kind = Node::Repeat;
+            node.kids = {atom};
+            node.min = min;
+            node.max = max;
+            atom = addNode(node);
+
+            // PCRE는 a+* 같은 겹친 수량자를 거부하므로 같이 거부 (PCRE rejects stacked quantifiers such as a+*, so do the same)
+            if (!atEnd() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{')) {
+                size_t save = m_pos;
+                int lo = 0, hi = 0;
+                if (peek() != '{' || parseBounds(lo, hi)) return fail("stacked quantifiers are not supported");
+                m_pos = save;
+            }
+        }
+        return atom;
+    }
+
+    int parseAtom() {
+        unsigned char c = next();
+        switch (c) {
+        case '(': {
+            if (!atEnd() && peek() == '?') {
+                if (m_pos + 1 < m_src.size() && m_src[m_pos + 1] == ':') m_pos += 2;
+                else return fail("group modifiers and lookaround are not supported");
+            }
+            int inner = parseAlt();
+            if (atEnd() || next() != ')') return fail("missing ')'");
+            return inner;
+        }
+        case '[':
+            return parseClass();
+        case '.': {
+            ByteSet set;
+            set.set();
+            set.reset('\n');
+            return addCharClass(set, true);
+        }
+        case '\\': {
+            ByteSet set;
+            bool negate = false;
+            if (!parseEscape(set, negate)) return fail(m_error.empty() ? "bad escape" : m_error);
+            return negate ? addCharClass(asciiComplement(set), true) : addCharClass(set, false);
+        }
+        case '^':
+        case '$':
+            return fail("anchors are not supported");
+        case '*':
+        case '+':
+        case '?':
+            return fail("nothing to repeat");
+        default: {
+            if (c < 0x80) {
+                ByteSet set;
+                set.set(c);
+                return addCharClass(set, false);
+            }
+            // 비ASCII 문자는 시퀀스 전체가 하나의 원자 (A non-ASCII character is one atom spanning its sequence)
+            const size_t length = utf8Length(c);
+            if (length == 0 || m_pos + length - 1 > m_src.size()) return fail("invalid UTF-8 in pattern");
+            if (m_ignoreCase) return fail("case-insensitive non-ASCII text is not supported");
+            std::vector<int> kids;
+            for (size_t i = 0; i < length; ++i) {
+                ByteSet set;
+                set.set(static_cast<unsigned char>(m_src[m_pos - 1 + i]));
+                kids.push_back(addSet(set));
+            }
+            m_pos += length - 1;
+            return addGroup(Node::Cat, kids);
+        }
+        }
+    }
+
+    static int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // 이스케이프를 바이트 집합으로 해석 (Parse an escape into a byte set)
+    bool parseEscape(ByteSet &set, bool &negate) {
+        if (atEnd()) {
+            m_error = "trailing backslash";
+            return false;
+        }
+        unsigned char c = next();
+        negate = false;
+        switch (c) {
+        case 'D': negate = true; /* fall through */
+        case 'd':
+            for (int i = '0'; i <= '9'; ++i) set.set(i);
+            return true;
+        case 'W': negate = true; /* fall through */
+        case 'w':
+            for (int i = '0'; i <= '9'; ++i) set.set(i);
+            for (int i = 'a'; i <= 'z'; ++i) { set.set(i); set.set(i - 32); }
+            set.set('_');
+            return true;
+        case 'S': negate = true; /* fall through */
+        case 's':
+            for (char ws : {' ', '\t', '\n', '\r', '\f', '\v'}) set.set(static_cast<unsigned char>(ws));
+            return true;
+        case 't': set.set('\t'); return true;
+        case 'n': set.set('\n'); return true;
+        case 'r': set.set('\r'); return true;
+        case 'f': set.set('\f'); return true;
+        case 'v': set.set('\v'); return true;
+        case 'x': {
+            int hi = m_pos < m_src.size() ? hexValue(m_src[m_pos]) : -1;
+            int lo = m_pos + 1 < m_src.size() ? hexValue(m_src[m_pos + 1]) : -1;
+            if (hi < 0 || lo < 0) {
+                m_error = "only \\xHH escapes are supported";
+                return false;
+            }
+            if (hi >= 8) {
+                m_error = "non-ASCII \\x escapes are not supported";
+                return false;
+            }
+            m_pos += 2;
+            set.set(hi * 16 + lo);
+            return true;
+        }
+        default:
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                m_error = std::string("unsupported escape \\") + static_cast<char>(c);
+                return false;
+            }
+            set.set(c);
+            return true;
+        }
+    }
+
+    int parseClass() {
+        ByteSet set;
+        bool nonAscii = false;
+        bool negate = false;
+        if (!atEnd() && peek() == '^') {
+            next();
+            negate = true;
+        }
+        bool first = true;
+        while (true) {
+            if (atEnd()) return fail("missing ']'");
+            unsigned char c = next();
+            if (c == ']' && !first) break;
+            first = false;
+
+            int lo = -1;
+            if (c == '\\') {
+                ByteSet escaped;
+                bool escNegate = false;
+                if (!parseEscape(escaped, escNegate)) return fail(m_error);
+                if (escNegate) {
+                    escaped = asciiComplement(escaped);
+                    nonAscii = true;
+                }
+                if (escaped.count() != 1) {
+                    set |= escaped;
+                    continue;
+                }
+                for (int i = 0; i < 256; ++i) {
+                    if (escaped[i]) lo = i;
+                }
+            } else if (c == '[' && !atEnd() && peek() == ':') {
+                return fail("POSIX classes are not supported");
+            } else if (c >= 0x80) {
+                return fail("non-ASCII characters in classes are not supported");
+            } else {
+                lo = c;
+            }
+
+            int hi = lo;
+            if (m_pos + 1 < m_src.size() && peek() == '-' && m_src[m_pos + 1] != ']') {
+                next();
+                unsigned char h = next();
+                if (h == '\\') {
+                    ByteSet escaped;
+                    bool escNegate = false;
+                    if (!parseEscape(escaped, escNegate) || escNegate || escaped.count() != 1) {
+                        return fail("invalid class range");
+                    }
+                    for (int i = 0; i < 256; ++i) {
+                        if (escaped[i]) hi = i;
+                    }
+                } else {
+                    hi = h;
+                }
+                if (hi < lo || hi >= 0x80) return fail("invalid class range");
+            }
+            for (int i = lo; i <= hi; ++i) set.set(i);
+        }
+        // 부정은 접은 뒤에 적용해야 [^a]가 대소문자 무시에서 A도 제외함 (Negate after folding so [^a] also excludes A)
+        fold(set);
+        if (negate) {
+            set = asciiComplement(set);
+            nonAscii = !nonAscii;
+        }
+        return addCharClass(set, nonAscii);
+    }
+
+    const std::string &m_src;
+    bool m_ignoreCase;
+    std::vector<Node> &m_nodes;
+    size_t m_pos = 0;
+    std::string m_error;
+};
+
+size_t PatternAutomaton::VectorHash::operator()(const std::vector<int> &v) const {
+    size_t hash = 14695981039346656037ULL;
+    for (int x : v) {
+        hash ^= static_cast<size_t>(x);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+int PatternAutomaton::addLiteral(const std::string &literal, bool ignoreCase, std::string *error) {
+    if (literal.empty()) {
+        if (error) *error = "empty literal";
+        return -1;
+    }
+    if (ignoreCase && !isAscii(literal)) {
+        if (error) *error = "case-insensitive non-ASCII text is not supported";
+        return -1;
+    }
+    if (ignoreCase && hasNonAsciiFold(literal)) {
+        // 바이트 단위 트라이로는 U+212A/U+017F를 접을 수 없으므로 NFA로 보냄 (The byte trie cannot fold these, so use the NFA)
+        std::string escaped;
+        for (char c : literal) {
+            if (!std::isalnum(static_cast<unsigned char>(c))) escaped += '\\';
+            escaped += c;
+        }
+        return addRegex(escaped, true, error);
+    }
+    m_literals.push_back({m_patternCount, literal, ignoreCase});
+    return m_patternCount++;
+}
+
+int PatternAutomaton::addRegex(const std::string &regex, bool ignoreCase, std::string *error) {
+    std::vector<Node> nodes;
+    std::string message;
+    Parser parser(regex, ignoreCase, nodes);
+    int root = parser.parse(message);
+    if (root < 0) {
+        if (error) *error = message;
+        return -1;
+    }
+
+    // 빈 문자열에 매칭되는 패턴은 모든 위치에서 매칭되므로 거부 (Patterns matching "" would fire everywhere)
+    std::vector<char> canBeEmpty(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const Node &node = nodes[i];
+        bool value = false;
+        switch (node.kind) {
+        case Node::Set: value = false; break;
+        case Node::Empty: value = true; break;
+        case Node::Cat:
+            value = std::all_of(node.kids.begin(), node.kids.end(), [&](int k) { return canBeEmpty[k]; });
+            break;
+        case Node::Alt:
+            value = std::any_of(node.kids.begin(), node.kids.end(), [&](int k) { return canBeEmpty[k]; });
+            break;
+        case Node::Repeat: value = node.min == 0 || canBeEmpty[node.kids[0]]; break;
+        }
+        canBeEmpty[i] = value;  // 자식은 항상 부모보다 먼저 생성됨 (Children are always created before parents)
+    }
+    if (canBeEmpty[root]) {
+        if (error) *error = "pattern matches the empty string";
+        return -1;
+    }
+
+    const size_t nfaBefore = m_nfa.size();
+    const size_t setsBefore = m_sets.size();
+    int accept = newNfaState();
+    m_nfa[accept].accept = m_patternCount;
+    // 중첩 반복은 상태 수가 곱으로 늘어나므로 만드는 도중에 예산으로 멈춤 (Nested repeats multiply, so stop mid-build on a budget)
+    size_t budget = kMaxNfaStatesPerPattern;
+    int start = compileNode(nodes, root, accept, budget);
+    if (budget == 0) {
+        m_nfa.resize(nfaBefore);
+        m_sets.resize(setsBefore);
+        if (error) *error = "pattern is too large";
+        return -1;
+    }
+
+    m_regexStarts.push_back(start);
+    return m_patternCount++;
+}
+
+int PatternAutomaton::newNfaState() {
+    m_nfa.emplace_back();
+    return static_cast<int>(m_nfa.size()) - 1;
+}
+
+// 출구 상태에서 거꾸로 NFA를 만들어 진입 상태를 반환 (Build the NFA backwards from the exit and return the entry)
+// 예산이 바닥나면 남은 부분을 만들지 않고 바로 돌아감 (Once the budget runs out, return without building the rest)
+int PatternAutomaton::compileNode(const std::vector<Node> &nodes, int index, int exit, size_t &budget) {
+    if (budget == 0) return exit;
+    const Node &node = nodes[index];
+    switch (node.kind) {
+    case Node::Empty:
+        return exit;
+    case Node::Set: {
+        --budget;
+        m_sets.push_back(node.set);
+        int state = newNfaState();
+        m_nfa[state].set = static_cast<int>(m_sets.size()) - 1;
+        m_nfa[state].next = exit;
+        return state;
+    }
+    case Node::Cat: {
+        int entry = exit;
+        for (auto it = node.kids.rbegin(); it != node.kids.rend(); ++it) {
+            entry = compileNode(nodes, *it, entry, budget);
+        }
+        return entry;
+    }
+    case Node::Alt: {
+        --budget;
+        int split = newNfaState();
+        for (int kid : node.kids) {
+            int entry = compileNode(nodes, kid, exit, budget);
+            m_nfa[split].eps.push_back(entry);
+        }
+        return split;
+    }
+    case Node::Repeat: {
+        int entry = exit;
+        if (node.max < 0) {
+            --budget;
+            int loop = newNfaState();
+            int body = compileNode(nodes, node.kids[0], loop, budget);
+            m_nfa[loop].eps = {body, exit};
+            entry = loop;
+        } else {
+            for (int i = node.min; i < node.max && budget > 0; ++i) {
+                --budget;
+                int optional = newNfaState();
+                int body = compileNode(nodes, node.kids[0], entry, budget);
+                m_nfa[optional].eps = {body, exit};
+                entry = optional;
+            }
+        }
+        for (int i = 0; i < node.min && budget > 0; ++i) {
+            entry = compileNode(nodes, node.kids[0], entry, budget);
+        }
+        return entry;
+    }
+    }
+    return exit;
+}
+
+void PatternAutomaton::compile() {
+    // Aho–Corasick: 대소문자를 접은 트라이에 실패 링크를 미리 풀어 넣은 완전 DFA
+    // Aho–Corasick: a case-folded trie with failure links resolved into a full DFA
+    m_acNodes.assign(1, AcNode());
+    m_acNodes[0].next.fill(-1);
+    for (size_t i = 0; i < m_literals.size(); ++i) {
+        int node = 0;
+        for (char ch : m_literals[i].text) {
+            unsigned char c = foldByte(static_cast<unsigned char>(ch));
+            if (m_acNodes[node].next[c] < 0) {
+                m_acNodes[node].next[c] = static_cast<int>(m_acNodes.size());
+                m_acNodes.emplace_back();
+                m_acNodes.back().next.fill(-1);
+            }
+            node = m_acNodes[node].next[c];
+        }
+        m_acNodes[node].outputs.push_back(static_cast<int>(i));
+    }
+
+    std::vector<int> queue;
+    for (int c = 0; c < 256; ++c) {
+        int child = m_acNodes[0].next[c];
+        if (child < 0) {
+            m_acNodes[0].next[c] = 0;
+        } else {
+            m_acNodes[child].fail = 0;
+            queue.push_back(child);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int node = queue[head];
+        for (int c = 0; c < 256; ++c) {
+            int child = m_acNodes[node].next[c];
+            int fallback = m_acNodes[m_acNodes[node].fail].next[c];
+            if (child < 0) {
+                m_acNodes[node].next[c] = fallback;
+            } else {
+                m_acNodes[child].fail = fallback;
+                const std::vector<int> &inherited = m_acNodes[fallback].outputs;
+                m_acNodes[child].outputs.insert(m_acNodes[child].outputs.end(), inherited.begin(), inherited.end());
+                queue.push_back(child);
+            }
+        }
+    }
+
+    // 정규식: 모든 패턴의 시작 상태를 하나의 엡실론 폐포로 합침
+    // Regexes: merge every pattern's start into one epsilon closure
+    m_startClosure = m_regexStarts;
+    closure(m_startClosure);
+    resetDfa();
+}
+
+void PatternAutomaton::closure(std::vector<int> &states) const {
+    std::vector<char> visited(m_nfa.size(), 0);
+    std::vector<int> stack(states.begin(), states.end());
+    std::vector<int> result;
+    while (!stack.empty()) {
+        int s = stack.back();
+        stack.pop_back();
+        if (visited[s]) continue;
+        visited[s] = 1;
+        const NfaState &state = m_nfa[s];
+        // 바이트 전이나 수락이 있는 상태만 DFA 상태를 구분 (Only byte or accepting states distinguish DFA states)
+        if (state.set >= 0 || state.accept >= 0) result.push_back(s);
+        for (int e : state.eps) {
+            if (!visited[e]) stack.push_back(e);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    states.swap(result);
+}
+
+int PatternAutomaton::internDfaState(std::vector<int> states) {
+    auto found = m_dfaIndex.find(states);
+    if (found != m_dfaIndex.end()) return found->second;
+
+    DfaState dfa;
+    dfa.next.fill(-1);
+    for (int s : states) {
+        if (m_nfa[s].accept >= 0) dfa.accepts.push_back(m_nfa[s].accept);
+    }
+    dfa.nfa = states;
+    m_dfaStates.push_back(std::move(dfa));
+    int id = static_cast<int>(m_dfaStates.size()) - 1;
+    m_dfaIndex.emplace(std::move(states), id);
+    return id;
+}
+
+void PatternAutomaton::resetDfa() {
+    m_dfaStates.clear();
+    m_dfaIndex.clear();
+    internDfaState(m_startClosure);
+}
+
+int PatternAutomaton::dfaTransition(int state, unsigned char byte) {
+    std::vector<int> target;
+    for (int s : m_dfaStates[state].nfa) {
+        const NfaState &nfa = m_nfa[s];
+        if (nfa.set >= 0 && m_sets[nfa.set][byte]) target.push_back(nfa.next);
+    }
+    closure(target);
+    // 어느 위치에서든 새 매칭이 시작될 수 있도록 시작 폐포를 항상 포함 (Always include the start closure for unanchored search)
+    std::vector<int> merged;
+    merged.reserve(target.size() + m_startClosure.size());
+    std::set_union(target.begin(), target.end(), m_startClosure.begin(), m_startClosure.end(),
+                   std::back_inserter(merged));
+
+    if (m_dfaStates.size() >= kMaxDfaStates) {
+        resetDfa();
+        return internDfaState(std::move(merged));
+    }
+    int id = internDfaState(std::move(merged));
+    m_dfaStates[state].next[byte] = id;
+    return id;
+}
+
+void PatternAutomaton::scan(const char *data, size_t size, std::vector<Match> &matches) {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+
+    if (!m_regexStarts.empty()) {
+        m_regexSeen.assign(m_patternCount, 0);
+        size_t remaining = m_regexStarts.size();
+        int state = 0;
+        for (size_t i = 0; i < size && remaining > 0; ++i) {
+            int next = m_dfaStates[state].next[bytes[i]];
+            state = next >= 0 ? next : dfaTransition(state, bytes[i]);
+            for (int pattern : m_dfaStates[state].accepts) {
+                if (!m_regexSeen[pattern]) {
+                    m_regexSeen[pattern] = 1;
+                    --remaining;
+                    matches.push_back({pattern, npos, i + 1});
+                }
+            }
+        }
+    }
+
+    if (!m_literals.empty()) {
+        int node = 0;
+        for (size_t i = 0; i < size; ++i) {
+            node = m_acNodes[node].next[foldByte(bytes[i])];
+            for (int index : m_acNodes[node].outputs) {
+                const Literal &literal = m_literals[index];
+                size_t start = i + 1 - literal.text.size();
+                if (!literal.ignoreCase && std::memcmp(data + start, literal.text.data(), literal.text.size()) != 0) {
+                    continue;
+                }
+                matches.push_back({literal.pattern, start, i + 1});
+            }
+        }
+    }
+}
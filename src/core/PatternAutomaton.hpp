@@ -0,0 +1,157 @@
+/**
+ * @file PatternAutomaton.hpp
+ * @brief 다중 패턴 단일 패스 매칭 엔진 (Single-Pass Multi-Pattern Matching Engine)
+ *
+ * 리터럴은 Aho–Corasick 오토마톤으로, 정규식은 하나로 합친 NFA를 지연 생성 DFA로 실행하여
+ * 입력을 한 번씩만 훑으며 모든 패턴을 동시에 검사합니다.
+ * Literals run through an Aho–Corasick automaton and regexes through one combined NFA
+ * executed as a lazily built DFA, so every pattern is checked in a single pass per engine.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef PATTERNAUTOMATON_HPP
+#define PATTERNAUTOMATON_HPP
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class PatternAutomaton
+ * @brief 리터럴/정규식 패턴 집합을 컴파일하고 UTF-8 바이트를 검사 (Compiles literal/regex sets and scans UTF-8 bytes)
+ *
+ * 지원하는 정규식 문법: 리터럴, `.`, `[...]`, `\\d \\w \\s` (및 대문자 부정형), `\\x00`~`\\x7F`, 그룹 `(...)`/`(?:...)`,
+ * `|`, `* + ? {m} {m,} {m,n}`. 앵커, 역참조, 전후방 탐색 등은 지원하지 않으며 addRegex가 false를 반환합니다.
+ * Supported regex syntax is listed above; anchors, backreferences and lookaround are rejected by addRegex.
+ *
+ * 입력은 UTF-8 바이트로 훑지만 `.`, 부정 클래스, `\\D \\W \\S`는 비ASCII 코드 포인트 하나를 통째로 소비하므로
+ * QRegularExpression과 같은 결과를 냅니다. 대소문자 무시는 ASCII 패턴에만 지원되며 비ASCII 문자와 함께 쓰면
+ * addRegex/addLiteral이 실패합니다.
+ * The input is scanned as UTF-8 bytes, but `.`, negated classes and `\\D \\W \\S` consume a whole non-ASCII code
+ * point, matching QRegularExpression. Case-insensitive matching is supported for ASCII patterns only; with
+ * non-ASCII text addRegex/addLiteral fail.
+ *
+ * DFA 캐시를 갱신하므로 scan()은 스레드 안전하지 않습니다.
+ * scan() updates the DFA cache and is therefore not thread-safe.
+ */
+class PatternAutomaton {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * @struct Match
+     * @brief 매칭 결과 (Match result)
+     */
+    struct Match {
+        int pattern;   ///< 패턴 번호 (Pattern index)
+        size_t start;  ///< 시작 바이트, 정규식은 npos (Start byte, npos for regexes)
+        size_t end;    ///< 끝 바이트 (다음 위치) (End byte, exclusive)
+    };
+
+    /**
+     * @brief 리터럴 패턴 추가 (Add a literal pattern)
+     * @param error 추가할 수 없을 때 이유 (Reason when the literal cannot be added)
+     * @return 패턴 번호, 실패 시 -1 (Pattern index, -1 on failure)
+     */
+    int addLiteral(const std::string &literal, bool ignoreCase, std::string *error = nullptr);
+
+    /**
+     * @brief 정규식 패턴 추가 (Add a regex pattern)
+     * @param error 지원하지 않는 문법일 때 이유 (Reason when the syntax is unsupported)
+     * @return 패턴 번호, 실패 시 -1 (Pattern index, -1 on failure)
+     */
+    int addRegex(const std::string &regex, bool ignoreCase, std::string *error = nullptr);
+
+    /**
+     * @brief 추가된 패턴으로 오토마톤 생성 (Build the automata from the added patterns)
+     */
+    void compile();
+
+    /**
+     * @brief 입력을 한 번 훑어 매칭 결과 수집 (Scan the input once and collect matches)
+     *
+     * 리터럴은 모든 위치를, 정규식은 패턴마다 첫 매칭 끝 위치만 보고합니다.
+     * Literals report every occurrence; regexes report only the first match end per pattern.
+     */
+    void scan(const char *data, size_t size, std::vector<Match> &matches);
+
+    /// 패턴 수 (Number of patterns)
+    int patternCount() const { return m_patternCount; }
+
+    /// 현재 캐시된 DFA 상태 수 (Number of cached DFA states)
+    size_t dfaStateCount() const { return m_dfaStates.size(); }
+
+private:
+    using ByteSet = std::bitset<256>;
+
+    // --- 정규식 구문 트리 (Regex syntax tree) ---
+    struct Node {
+        enum Kind { Set, Cat, Alt, Repeat, Empty } kind;
+        ByteSet set;
+        std::vector<int> kids;
+        int min = 0;
+        int max = 0;  // -1 = 무한 (unbounded)
+    };
+
+    class Parser;
+
+    // --- NFA ---
+    struct NfaState {
+        int set = -1;          // 바이트 전이 집합 번호, -1이면 엡실론 전용 (Byte set index, -1 for epsilon-only)
+        int next = -1;         // 바이트 전이 대상 (Byte transition target)
+        std::vector<int> eps;  // 엡실론 전이 (Epsilon transitions)
+        int accept = -1;       // 수락 패턴 번호 (Accepted pattern index)
+    };
+
+    // --- 지연 DFA (Lazy DFA) ---
+    struct DfaState {
+        std::vector<int> nfa;           // 정렬된 NFA 상태 집합 (Sorted NFA state set)
+        std::vector<int> accepts;       // 수락 패턴들 (Accepted patterns)
+        std::array<int, 256> next;      // 전이 캐시, -1은 미계산 (Transition cache, -1 = not computed)
+    };
+
+    struct VectorHash {
+        size_t operator()(const std::vector<int> &v) const;
+    };
+
+    // --- Aho–Corasick ---
+    struct AcNode {
+        std::array<int, 256> next;
+        int fail = 0;
+        std::vector<int> outputs;  // 리터럴 번호 (Literal indexes)
+    };
+
+    struct Literal {
+        int pattern;
+        std::string text;
+        bool ignoreCase;
+    };
+
+    int compileNode(const std::vector<Node> &nodes, int node, int exit, size_t &budget);
+    int newNfaState();
+    void closure(std::vector<int> &states) const;
+    int internDfaState(std::vector<int> states);
+    int dfaTransition(int state, unsigned char byte);
+    void resetDfa();
+
+    int m_patternCount = 0;
+
+    std::vector<Literal> m_literals;
+    std::vector<AcNode> m_acNodes;
+
+    std::vector<ByteSet> m_sets;
+    std::vector<NfaState> m_nfa;
+    std::vector<int> m_regexStarts;
+    std::vector<int> m_startClosure;
+    std::vector<DfaState> m_dfaStates;
+    std::unordered_map<std::vector<int>, int, VectorHash> m_dfaIndex;
+    std::vector<char> m_regexSeen;
+};
+
+#endif // PATTERNAUTOMATON_HPP
@@ -0,0 +1,228 @@
+#include "DiffDialog.hpp"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QSyntaxHighlighter>
+#include <QTextCharFormat>
+#include <QFontDatabase>
+#include <QElapsedTimer>
+#include <QMetaObject>
+#include <QSignalBlocker>
+#include "../plugins/TextProcessor.hpp"
+
+namespace {
+// 하이라이터가 느려지지 않도록 표시할 최대 길이 (Longest output shown, keeps highlighting fast)
+const int kMaxDisplayChars = 1000000;
+
+enum BlockState { Outside = 0, InDeletion = 1, InInsertion = 2 };
+}
+
+/**
+ * @class DiffHighlighter
+ * @brief 비교 결과 강조 (Comparison Output Highlighter)
+ *
+ * 단어 단위 표기는 여러 줄에 걸칠 수 있으므로 블록 상태로 열린 표기를 다음 줄에 넘깁니다.
+ * Word markers may span lines, so an open marker is carried to the next line through the block state.
+ */
+class DiffHighlighter : public QSyntaxHighlighter {
+public:
+    explicit DiffHighlighter(QTextDocument *document) : QSyntaxHighlighter(document) {
+        m_deleted.setBackground(QColor(255, 80, 80, 90));
+        m_deleted.setForeground(QColor("#ffd0d0"));
+        m_inserted.setBackground(QColor(80, 255, 120, 80));
+        m_inserted.setForeground(QColor("#d0ffd8"));
+        m_fold.setForeground(QColor(255, 255, 255, 120));
+        m_fold.setFontItalic(true);
+    }
+
+    void setGranularity(DiffGranularity granularity) { m_granularity = granularity; }
+
+protected:
+    void highlightBlock(const QString &text) override {
+        if (text.startsWith("@@") && previousBlockState() <= Outside) {
+            setFormat(0, text.length(), m_fold);
+            setCurrentBlockState(Outside);
+            return;
+        }
+        if (m_granularity == DiffGranularity::Line) {
+            if (text.startsWith("- ")) setFormat(0, text.length(), m_deleted);
+            else if (text.startsWith("+ ")) setFormat(0, text.length(), m_inserted);
+            return;
+        }
+
+        int state = qMax(int(Outside), previousBlockState());
+        int pos = 0;
+        while (pos < text.length()) {
+            if (state == Outside) {
+                const int del = text.indexOf("[-", pos);
+                const int ins = text.indexOf("{+", pos);
+                if (del < 0 && ins < 0) break;
+                if (ins < 0 || (del >= 0 && del < ins)) {
+                    state = InDeletion;
+                    pos = del;
+                } else {
+                    state = InInsertion;
+                    pos = ins;
+                }
+                continue;
+            }
+            const int end = text.indexOf(state == InDeletion ? "-]" : "+}", pos);
+            const int stop = end < 0 ? text.length() : end + 2;
+            setFormat(pos, stop - pos, state == InDeletion ? m_deleted : m_inserted);
+            pos = stop;
+            if (end >= 0) state = Outside;
+        }
+        setCurrentBlockState(state);
+    }
+
+private:
+    DiffGranularity m_granularity = DiffGranularity::Line;
+    QTextCharFormat m_deleted;
+    QTextCharFormat m_inserted;
+    QTextCharFormat m_fold;
+};
+
+DiffDialog::DiffDialog(const QString &before, const QString &after, QWidget *parent)
+    : QDialog(parent), m_before(before), m_after(after) {
+    setWindowTitle("🔀 항목 비교 (Compare Items)");
+    resize(760, 640);
+
+    m_granularityBox = new QComboBox(this);
+    m_granularityBox->addItem("줄 단위 (Lines)");
+    m_granularityBox->addItem("단어 단위 (Words)");
+
+    // 두 항목이 모두 JSON이면 키 정렬된 들여쓰기로 맞춰 구조만 비교, 판별은 작업 스레드에서 함
+    // When both items are JSON, compare structure via key-sorted indented output; detection runs on the worker
+    m_jsonCheck = new QCheckBox("JSON 정규화 (Normalize JSON)", this);
+    m_jsonCheck->setChecked(true);
+
+    m_view = new QPlainTextEdit(this);
+    m_view->setReadOnly(true);
+    m_view->setLineWrapMode(QPlainTextEdit::NoWrap);
+    m_view->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    m_view->setStyleSheet(
+        "QPlainTextEdit { "
+        "  background: rgba(0, 0, 0, 0.35); "
+        "  color: #ffffff; "
+        "  border: 1px solid rgba(255, 255, 255, 0.3); "
+        "  border-radius: 12px; "
+        "  padding: 8px; "
+        "}"
+    );
+    m_highlighter = new DiffHighlighter(m_view->document());
+
+    m_statusLabel = new QLabel(this);
+    m_statusLabel->setStyleSheet("color: #ffffff; font-size: 11px; font-weight: bold;");
+
+    QHBoxLayout *optionLayout = new QHBoxLayout;
+    optionLayout->addWidget(m_granularityBox);
+    optionLayout->addWidget(m_jsonCheck);
+    optionLayout->addStretch();
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(15, 15, 15, 15);
+    layout->addLayout(optionLayout);
+    layout->addWidget(m_view);
+    layout->addWidget(m_statusLabel);
+
+    setStyleSheet(
+        "QDialog { "
+        "  background: qlineargradient(spread:pad, x1:0, y1:0, x2:1, y2:1, stop:0 #004b73, stop:0.5 #0078d4, stop:1 #00b4ff); "
+        "} "
+        "QCheckBox { color: #ffffff; } "
+    );
+
+    connect(m_granularityBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &DiffDialog::startDiff);
+    connect(m_jsonCheck, &QCheckBox::toggled, this, &DiffDialog::startDiff);
+    startDiff();
+}
+
+DiffDialog::~DiffDialog() {
+    // 작업 스레드가 this를 참조하므로 끝날 때까지 기다림 (Workers reference this, so wait for them)
+    if (m_cancel) m_cancel->store(true);
+    for (QThread *worker : m_workers) {
+        worker->wait();
+        delete worker;
+    }
+}
+
+void DiffDialog::startDiff() {
+    if (m_cancel) m_cancel->store(true);
+    auto cancel = std::make_shared<std::atomic_bool>(false);
+    m_cancel = cancel;
+
+    const int generation = ++m_generation;
+    const DiffGranularity granularity = m_granularityBox->currentIndex() == 1 ? DiffGranularity::Word : DiffGranularity::Line;
+    const bool normalize = m_jsonCheck->isEnabled() && m_jsonCheck->isChecked();
+    const QString before = m_before;
+    const QString after = m_after;
+    m_statusLabel->setText("⏳ 비교 중... (Comparing...)");
+
+    QThread *worker = QThread::create([this, cancel, generation, granularity, normalize, before, after]() {
+        QElapsedTimer timer;
+        timer.start();
+        QString a = before;
+        QString b = after;
+        bool normalized = false;
+        if (normalize) {
+            QString jsonA, jsonB;
+            normalized = TextProcessor::normalizeJson(before, &jsonA) && TextProcessor::normalizeJson(after, &jsonB);
+            if (normalized) {
+                a = jsonA;
+                b = jsonB;
+            }
+        }
+        const DiffResult result = TextDiff::compare(a, b, granularity, cancel.get());
+        if (result.cancelled) return;
+
+        const int added = result.addedLines;
+        const int removed = result.removedLines;
+        QString text = added || removed ? TextDiff::render(result, granularity) : QString();
+        if (text.size() > kMaxDisplayChars) {
+            // 한도 안에 줄바꿈이 없으면 서로게이트 쌍을 피해 그 자리에서 자름
+            // Without a newline within the limit, hard-cut there while keeping surrogate pairs whole
+            const int newline = text.lastIndexOf('\n', kMaxDisplayChars);
+            if (newline >= 0) {
+                text.truncate(newline + 1);
+            } else {
+                text.truncate(text.at(kMaxDisplayChars - 1).isHighSurrogate() ? kMaxDisplayChars - 1 : kMaxDisplayChars);
+                text += '\n';
+            }
+            text += "@@ 표시 한도 초과, 이후 생략 (Output truncated) @@\n";
+        }
+        const qint64 elapsed = timer.elapsed();
+        QMetaObject::invokeMethod(this, [=]() {
+            showResult(generation, added, removed, text, elapsed, normalized);
+        }, Qt::QueuedConnection);
+    });
+    m_workers.append(worker);
+    connect(worker, &QThread::finished, this, [this, worker]() {
+        m_workers.removeOne(worker);
+        worker->deleteLater();
+    });
+    worker->start();
+}
+
+void DiffDialog::showResult(int generation, int addedLines, int removedLines, const QString &text, qint64 elapsedMs,
+                            bool normalized) {
+    // 새 비교가 시작된 뒤 도착한 결과는 무시 (Ignore results that arrive after a newer comparison started)
+    if (generation != m_generation) return;
+
+    // JSON이 아니라고 판별되면 다음 비교부터 다시 판별하지 않도록 끔 (Once found not to be JSON, disable so later runs skip detection)
+    if (m_jsonCheck->isEnabled() && m_jsonCheck->isChecked() && !normalized) {
+        const QSignalBlocker blocker(m_jsonCheck);
+        m_jsonCheck->setChecked(false);
+        m_jsonCheck->setEnabled(false);
+    }
+
+    const DiffGranularity granularity = m_granularityBox->currentIndex() == 1 ? DiffGranularity::Word : DiffGranularity::Line;
+    m_highlighter->setGranularity(granularity);
+    if (addedLines == 0 && removedLines == 0) {
+        m_view->setPlainText("두 항목이 같습니다. (The items are identical.)");
+    } else {
+        m_view->setPlainText(text);
+    }
+    QString status = QString("➕ %1줄 (lines) | ➖ %2줄 (lines) | ⏱️ %3 ms")
+                         .arg(addedLines).arg(removedLines).arg(elapsedMs);
+    if (normalized) status += " | 🧩 JSON 정규화됨 (JSON normalized)";
+    m_statusLabel->setText(status);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file DiffDialog.hpp
+ * @brief 두 히스토리 항목 비교 창 (Two History Items Comparison Dialog)
+ *
+ * 비교는 작업 스레드에서 실행되므로 수 MB 입력에서도 창이 멈추지 않습니다.
+ * Comparison runs on a worker thread, so the window stays responsive on multi-megabyte inputs.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef DIFFDIALOG_HPP
+#define DIFFDIALOG_HPP
+
+#include <QDialog>
+#include <QList>
+#include <QThread>
+#include <QComboBox>
+#include <QCheckBox>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <atomic>
+#include <memory>
+#include "../plugins/TextDiff.hpp"
+
+class DiffHighlighter;
+
+/**
+ * @class DiffDialog
+ * @brief 비교 결과 표시 창 (Comparison Result Dialog)
+ *
+ * 단위나 JSON 정규화를 바꾸면 진행 중인 비교를 취소하고 새로 시작하며, 늦게 끝난 이전 결과는 버립니다.
+ * JSON 판별도 작업 스레드에서 하며, 두 항목이 모두 JSON일 때만 정규화합니다.
+ * Changing granularity or JSON normalization cancels the running comparison and starts a new one;
+ * stale results that finish late are discarded. JSON detection also runs on the worker, and
+ * normalization applies only when both items are JSON.
+ */
+class DiffDialog : public QDialog {
+    Q_OBJECT
+public:
+    /**
+     * @param before 이전 항목 내용 (Earlier item content)
+     * @param after 이후 항목 내용 (Later item content)
+     */
+    DiffDialog(const QString &before, const QString &after, QWidget *parent = nullptr);
+    ~DiffDialog() override;
+
+private slots:
+    void startDiff();
+
+private:
+    void showResult(int generation, int addedLines, int removedLines, const QString &text, qint64 elapsedMs,
+                    bool normalized);
+
+    QString m_before;
+    QString m_after;
+
+    QComboBox *m_granularityBox;
+    QCheckBox *m_jsonCheck;
+    QPlainTextEdit *m_view;
+    QLabel *m_statusLabel;
+    DiffHighlighter *m_highlighter;
+
+    int m_generation = 0;                        ///< 최신 비교 번호 (Latest comparison number)
+    std::shared_ptr<std::atomic_bool> m_cancel;  ///< 진행 중인 비교의 취소 플래그 (Cancel flag of the running comparison)
+    QList<QThread *> m_workers;                  ///< 아직 끝나지 않은 작업 스레드 (Workers still running)
+};
+
+#endif // DIFFDIALOG_HPP
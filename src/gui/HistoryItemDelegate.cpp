@@ -0,0 +1,152 @@
+#include "HistoryItemDelegate.hpp"
+#include <QPainter>
+#include <QPainterPath>
+#include <QPixmapCache>
+#include <QImage>
+#include <QLinearGradient>
+#include <QApplication>
+#include <qdrawutil.h>
+
+namespace {
+const int kPadding = 18;       // 카드 안쪽 여백 (Inner card padding)
+const int kSpacing = 8;        // 카드 사이 간격 (Gap between cards)
+const int kRadius = 12;        // 모서리 반경 (Corner radius)
+const int kShadowBlur = 6;     // 그림자 번짐 (Shadow blur)
+const int kShadowOffsetY = 3;  // 그림자 세로 오프셋 (Shadow vertical offset)
+
+// 알파 채널만 가진 검은 그림자에 3회 상자 흐림 적용 (Three box-blur passes over a black, alpha-only shadow)
+void blurAlpha(QImage &image, int radius) {
+    const int w = image.width();
+    const int h = image.height();
+    QVector<int> line(qMax(w, h));
+    for (int pass = 0; pass < 3; ++pass) {
+        for (int horizontal = 1; horizontal >= 0; --horizontal) {
+            const int outer = horizontal ? h : w;
+            const int inner = horizontal ? w : h;
+            for (int o = 0; o < outer; ++o) {
+                auto pixel = [&](int i) -> QRgb & {
+                    int x = horizontal ? i : o;
+                    int y = horizontal ? o : i;
+                    return reinterpret_cast<QRgb *>(image.scanLine(y))[x];
+                };
+                for (int i = 0; i < inner; ++i) line[i] = qAlpha(pixel(i));
+                int sum = 0;
+                for (int i = -radius; i <= radius; ++i) sum += line[qBound(0, i, inner - 1)];
+                for (int i = 0; i < inner; ++i) {
+                    const int a = sum / (2 * radius + 1);
+                    pixel(i) = qRgba(0, 0, 0, a);
+                    sum += line[qMin(i + radius + 1, inner - 1)] - line[qMax(i - radius, 0)];
+                }
+            }
+        }
+    }
+}
+}
+
+HistoryItemDelegate::HistoryItemDelegate(QObject *parent) : QStyledItemDelegate(parent), m_textCache(4000) {
+    // 그림자 나인패치: 흐린 둥근 사각형 하나를 만들고 가장자리만 늘려 씁니다
+    // Shadow nine-patch: blur one rounded rect once and stretch only its middle
+    const int margin = 2 * kShadowBlur + kRadius;
+    const int side = 2 * margin + 1;
+    QImage image(side, side, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    {
+        QPainter p(&image);
+        p.setRenderHint(QPainter::Antialiasing);
+        p.setPen(Qt::NoPen);
+        p.setBrush(QColor(0, 0, 0, 180));
+        p.drawRoundedRect(QRectF(2 * kShadowBlur, 2 * kShadowBlur, side - 4 * kShadowBlur, side - 4 * kShadowBlur),
+                          kRadius, kRadius);
+    }
+    blurAlpha(image, kShadowBlur / 2);
+    m_shadow = QPixmap::fromImage(image);
+}
+
+QSize HistoryItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &) const {
+    // 모든 행 높이가 같으므로 setUniformItemSizes와 함께 레이아웃 비용이 일정합니다
+    // Every row has the same height, which keeps layout constant-time with setUniformItemSizes
+    return QSize(option.rect.width(), option.fontMetrics.height() + 2 * kPadding + kSpacing);
+}
+
+QPixmap HistoryItemDelegate::cardPixmap(const QSize &size, CardState state, qreal dpr) const {
+    const QString key = QString("clipsmith-card-%1x%2-%3-%4").arg(size.width()).arg(size.height()).arg(state).arg(dpr);
+    QPixmap pixmap;
+    if (QPixmapCache::find(key, &pixmap)) {
+        return pixmap;
+    }
+
+    pixmap = QPixmap(size * dpr);
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
+
+    QPainter p(&pixmap);
+    p.setRenderHint(QPainter::Antialiasing);
+    const QRectF rect = QRectF(QPointF(0, 0), QSizeF(size)).adjusted(0.5, 0.5, -0.5, -0.5);
+    QPainterPath path;
+    path.addRoundedRect(rect, kRadius, kRadius);
+
+    if (state == Selected) {
+        QLinearGradient gradient(rect.topLeft(), rect.bottomLeft());
+        gradient.setColorAt(0, QColor(0, 180, 255, 204));
+        gradient.setColorAt(1, QColor(0, 120, 212, 153));
+        p.fillPath(path, gradient);
+        p.setPen(QPen(Qt::white, 1));
+        p.drawPath(path);
+    } else {
+        // 상단 광택을 더한 반투명 유리 (Translucent glass with a glossy top edge)
+        QLinearGradient gradient(rect.topLeft(), rect.bottomLeft());
+        const int base = state == Hovered ? 38 : 8;
+        gradient.setColorAt(0, QColor(255, 255, 255, base + 20));
+        gradient.setColorAt(0.5, QColor(255, 255, 255, base));
+        gradient.setColorAt(1, QColor(255, 255, 255, base + 6));
+        p.fillPath(path, gradient);
+        p.setPen(QPen(QColor(255, 255, 255, 26), 1));
+        p.drawPath(path);
+    }
+    p.end();
+
+    QPixmapCache::insert(key, pixmap);
+    return pixmap;
+}
+
+void HistoryItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const {
+    const QRect card = option.rect.adjusted(kShadowBlur, 0, -kShadowBlur, -kSpacing);
+    if (!card.isValid()) return;
+
+    CardState state = Normal;
+    if (option.state & QStyle::State_Selected) state = Selected;
+    else if (option.state & QStyle::State_MouseOver) state = Hovered;
+
+    // 그림자 나인패치 (Shadow nine-patch)
+    const int margin = 2 * kShadowBlur + kRadius;
+    const QRect shadowRect = card.adjusted(-2 * kShadowBlur, -2 * kShadowBlur + kShadowOffsetY,
+                                           2 * kShadowBlur, 2 * kShadowBlur + kShadowOffsetY);
+    painter->save();
+    painter->setClipRect(option.rect);
+    qDrawBorderPixmap(painter, shadowRect, QMargins(margin, margin, margin, margin), m_shadow);
+    painter->restore();
+
+    painter->drawPixmap(card.topLeft(), cardPixmap(card.size(), state, painter->device()->devicePixelRatioF()));
+
+    // 텍스트 레이아웃은 항목 ID, 너비, 글꼴 단위로 캐시하고 원문 전체를 비교해 바뀐 내용은 다시 만듦
+    // Text layouts are cached per item ID, width and font; the full text is compared so changed content is rebuilt
+    const QString text = index.data(Qt::DisplayRole).toString();
+    const int textWidth = card.width() - 2 * kPadding;
+    if (textWidth <= 0) return;
+    const TextKey key{index.data(Qt::UserRole + 1).toInt(), textWidth, option.font.key()};
+
+    TextEntry *entry = m_textCache.object(key);
+    if (!entry || entry->text != text) {
+        entry = new TextEntry{text, QStaticText(option.fontMetrics.elidedText(text, Qt::ElideRight, textWidth))};
+        entry->layout.setTextFormat(Qt::PlainText);
+        entry->layout.prepare(QTransform(), option.font);
+        m_textCache.insert(key, entry);
+    }
+
+    painter->save();
+    painter->setFont(option.font);
+    painter->setPen(Qt::white);
+    const int y = card.top() + (card.height() - option.fontMetrics.height()) / 2;
+    painter->drawStaticText(card.left() + kPadding, y, entry->layout);
+    painter->restore();
+}
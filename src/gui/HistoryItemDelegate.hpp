@@ -0,0 +1,74 @@
+/**
+ * @file HistoryItemDelegate.hpp
+ * @brief 히스토리 리스트 항목 그리기 델리게이트 (History List Item Painting Delegate)
+ *
+ * 스타일시트와 그래픽 효과 대신 캐시된 픽스맵으로 유리 질감 카드를 직접 그립니다.
+ * Paints the glass cards directly from cached pixmaps instead of stylesheets and graphics effects.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef HISTORYITEMDELEGATE_HPP
+#define HISTORYITEMDELEGATE_HPP
+
+#include <QStyledItemDelegate>
+#include <QCache>
+#include <QHash>
+#include <QPixmap>
+#include <QStaticText>
+
+/**
+ * @class HistoryItemDelegate
+ * @brief 유리 카드 항목 델리게이트 (Glass Card Item Delegate)
+ *
+ * 배경은 크기/상태별로, 텍스트 레이아웃은 항목/너비/글꼴별로 캐시하고, 그림자는 미리 렌더링한
+ * 나인패치 한 장을 늘려 그리므로 스크롤 중에는 픽스맵 복사만 일어납니다.
+ * Backgrounds are cached per size/state, text layouts per item/width/font, and the shadow is a single
+ * pre-rendered nine-patch, so scrolling only blits pixmaps.
+ */
+class HistoryItemDelegate : public QStyledItemDelegate {
+    Q_OBJECT
+public:
+    explicit HistoryItemDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+    enum CardState { Normal, Hovered, Selected };
+
+    /**
+     * @brief 텍스트 레이아웃 캐시 키 (Text layout cache key)
+     */
+    struct TextKey {
+        int id;        ///< 항목 ID (Item ID)
+        int width;     ///< 텍스트 영역 너비 (Text area width)
+        QString font;  ///< QFont::key()
+
+        bool operator==(const TextKey &other) const {
+            return id == other.id && width == other.width && font == other.font;
+        }
+        friend decltype(qHash(0)) qHash(const TextKey &key, decltype(qHash(0)) seed = 0) {
+            return qHash(key.font, seed) ^ qHash((qint64(key.id) << 32) | quint32(key.width), seed);
+        }
+    };
+
+    /**
+     * @brief 캐시된 텍스트 레이아웃과 원문 (Cached text layout with its source text)
+     */
+    struct TextEntry {
+        QString text;        ///< 레이아웃을 만든 원문, 내용이 바뀌었는지 확인용 (Source text, detects changed content)
+        QStaticText layout;  ///< 말줄임된 레이아웃 (Elided layout)
+    };
+
+    /**
+     * @brief 크기/상태별 카드 배경 (Card background per size and state)
+     */
+    QPixmap cardPixmap(const QSize &size, CardState state, qreal dpr) const;
+
+    QPixmap m_shadow;                                 ///< 그림자 나인패치 (Shadow nine-patch)
+    mutable QCache<TextKey, TextEntry> m_textCache;   ///< 항목별 텍스트 레이아웃 (Per-item text layouts)
+};
+
+#endif // HISTORYITEMDELEGATE_HPP
@@ -15,13 +15,20 @@
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QMessageBox>
-#include <QGraphicsDropShadowEffect>
+#include <QFileDialog>
+#include <utility>
+#include "HistoryItemDelegate.hpp"
+#include "DiffDialog.hpp"
+#include "../core/HistoryTransfer.hpp"
 
 MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     // DB 관리자 및 클립보드 모니터링 초기화
     // Initialize DB Manager and Clipboard Monitoring
     m_dbManager = new DatabaseManager(this);
     m_dbManager->init();
+    connect(m_dbManager, &DatabaseManager::itemsChanged, this, &MainWindow::onExternalItemsChanged);
+    connect(m_dbManager, &DatabaseManager::historyReset, this, &MainWindow::onExternalReset);
+    connect(m_dbManager, &DatabaseManager::itemsExpired, this, &MainWindow::onItemsExpired);
 
     m_cbMonitor = new ClipboardMonitor(this);
     connect(m_cbMonitor, &ClipboardMonitor::contentChanged, this, &MainWindow::onNewContent);
@@ -32,6 +39,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent) {
     createTrayIcon();
     refreshList();
 
+    // 감시 시작 시 만료 항목을 바로 지우고 알리므로 UI가 준비된 뒤에 시작
+    // Watching purges and reports expired items immediately, so start it once the UI exists
+    m_dbManager->startWatching();
+
     setWindowTitle("Clipsmith 🛠️");
     resize(480, 750);
 }
@@ -87,9 +98,14 @@ void MainWindow::setupUi() {
     m_toolBar->addSeparator();
     m_copyAction = m_toolBar->addAction("📋 재복사 (Copy)");
     m_deleteAction = m_toolBar->addAction("🗑️ 삭제 (Delete)");
+    m_compareAction = m_toolBar->addAction("🔀 비교 (Compare)");
+    m_toolBar->addSeparator();
+    m_groupAction = m_toolBar->addAction("🧩 유사 묶기 (Group)");
+    m_groupAction->setCheckable(true);
 
     m_prettifyAction->setEnabled(false);
     m_decodeAction->setEnabled(false);
+    m_compareAction->setEnabled(false);
 
     // 신호 연결
     connect(m_prettifyAction, &QAction::triggered, this, &MainWindow::actionPrettify);
@@ -97,6 +113,8 @@ void MainWindow::setupUi() {
     connect(m_cleanAction, &QAction::triggered, this, &MainWindow::actionCleanText);
     connect(m_copyAction, &QAction::triggered, this, &MainWindow::actionCopyItem);
     connect(m_deleteAction, &QAction::triggered, this, &MainWindow::actionDeleteItem);
+    connect(m_groupAction, &QAction::toggled, this, &MainWindow::actionToggleGrouping);
+    connect(m_compareAction, &QAction::triggered, this, &MainWindow::actionCompareItems);
 
     // 히스토리 리스트 위젯 스타일링 (Aero Glass List & Custom Scrollbar)
     m_historyList = new QListWidget(this);
@@ -109,21 +127,6 @@ void MainWindow::setupUi() {
         "  outline: none; "
         "  padding: 10px; "
         "} "
-        "QListWidget::item { "
-        "  padding: 18px; "
-        "  border-bottom: 1px solid rgba(255, 255, 255, 0.1); "
-        "  border-radius: 12px; "
-        "  margin-bottom: 8px; "
-        "  background: rgba(255, 255, 255, 0.03); "
-        "} "
-        "QListWidget::item:selected { "
-        "  background: qlineargradient(x1:0, y1:0, x2:0, y2:1, stop:0 rgba(0, 180, 255, 0.8), stop:1 rgba(0, 120, 212, 0.6)); "
-        "  border: 1px solid white; "
-        "  color: white; "
-        "} "
-        "QListWidget::item:hover { "
-        "  background: rgba(255, 255, 255, 0.15); "
-        "} "
         "QScrollBar:vertical { "
         "  border: none; "
         "  background: rgba(255, 255, 255, 0.05); "
@@ -140,6 +143,12 @@ void MainWindow::setupUi() {
         "  background: rgba(255, 255, 255, 0.5); "
         "} "
     );
+    // 항목 카드는 델리게이트가 캐시된 픽스맵으로 직접 그림 (Item cards are painted by the delegate from cached pixmaps)
+    m_historyList->setItemDelegate(new HistoryItemDelegate(m_historyList));
+    m_historyList->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    m_historyList->setUniformItemSizes(true);
+    m_historyList->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    m_historyList->viewport()->setAttribute(Qt::WA_Hover);
     connect(m_historyList, &QListWidget::itemDoubleClicked, this, &MainWindow::onItemDoubleClicked);
     connect(m_historyList, &QListWidget::itemSelectionChanged, this, &MainWindow::onSelectionChanged);
 
@@ -164,19 +173,12 @@ void MainWindow::setupUi() {
         "  color: #ffffff; " // 전체 텍스트 기본색 흰색 (Global text white)
         "} "
     );
-
-    // 시스템 트레이 그림자 효과
-    // Shadow effects
-    QGraphicsDropShadowEffect *shadow = new QGraphicsDropShadowEffect(this);
-    shadow->setBlurRadius(20);
-    shadow->setColor(QColor(0, 0, 0, 180));
-    shadow->setOffset(0, 4);
-    m_historyList->setGraphicsEffect(shadow);
 }
 
 void MainWindow::onSelectionChanged() {
     // 선택된 항목에 따른 액션 상태 업데이트
     // Update action states based on selected item
+    m_compareAction->setEnabled(m_historyList->selectedItems().size() == 2);
     QListWidgetItem *item = m_historyList->currentItem();
     if (!item) {
         m_prettifyAction->setEnabled(false);
@@ -259,19 +261,177 @@ void MainWindow::actionDeleteItem() {
     }
 }
 
+void MainWindow::actionCompareItems() {
+    // 선택한 두 항목을 오래된 것부터 비교 (Compare the two selected items, older first)
+    QList<QListWidgetItem *> items = m_historyList->selectedItems();
+    if (items.size() != 2) return;
+    if (items[0]->data(Qt::UserRole + 3).toDateTime() > items[1]->data(Qt::UserRole + 3).toDateTime()) {
+        std::swap(items[0], items[1]);
+    }
+
+    DiffDialog *dialog = new DiffDialog(items[0]->data(Qt::UserRole).toString(),
+                                        items[1]->data(Qt::UserRole).toString(), this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
+    m_statusLabel->setText("🔀 두 항목을 비교합니다. (Comparing two items.)");
+}
+
+void MainWindow::actionExportHistory() {
+    // 히스토리 파일로 내보내기 (Export history to a file)
+    QString path = QFileDialog::getSaveFileName(this, "히스토리 내보내기 (Export History)", "clipsmith-history.clsh",
+                                                "Clipsmith Binary (*.clsh);;JSON Lines (*.jsonl)");
+    if (path.isEmpty()) return;
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    qint64 count = HistoryTransfer::exportHistory(m_dbManager, path);
+    QApplication::restoreOverrideCursor();
+
+    if (count < 0) {
+        m_statusLabel->setText("❌ 내보내기에 실패했습니다. (Export failed.)");
+    } else {
+        m_statusLabel->setText(QString("📤 %1개 항목을 내보냈습니다. (Exported %1 items.)").arg(count));
+    }
+}
+
+void MainWindow::actionImportHistory() {
+    // 파일에서 히스토리 가져오기 (Import history from a file)
+    QString path = QFileDialog::getOpenFileName(this, "히스토리 가져오기 (Import History)", QString(),
+                                                "Clipsmith History (*.clsh *.jsonl *.ndjson);;All Files (*)");
+    if (path.isEmpty()) return;
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    qint64 count = HistoryTransfer::importHistory(m_dbManager, path);
+    QApplication::restoreOverrideCursor();
+
+    if (count < 0) {
+        m_statusLabel->setText("❌ 가져오기에 실패했습니다. (Import failed.)");
+    } else {
+        refreshList();
+        m_statusLabel->setText(QString("📥 %1개 새 항목을 가져왔습니다. (Imported %1 new items.)").arg(count));
+    }
+}
+
+void MainWindow::actionReloadRules() {
+    // 캡처 규칙 파일 다시 읽기 (Reload the capture rule file)
+    m_cbMonitor->reloadRules();
+    m_statusLabel->setText(QString("🛡️ 캡처 규칙 %1개 적용됨. (%1 capture rules loaded.)").arg(m_cbMonitor->rules().ruleCount()));
+}
+
+void MainWindow::actionShowRuleStats() {
+    // 규칙 매칭 통계 표시 (Show rule matching statistics)
+    QMessageBox::information(this, "규칙 통계 (Rule Stats)", m_cbMonitor->rules().statsSummary());
+}
+
 void MainWindow::refreshList() {
     // 히스토리 리스트 갱신 (Refresh history list)
+    populateList(m_dbManager->getAllItems());
+}
+
+void MainWindow::populateList(const QList<ClipboardItem> &items) {
     m_historyList->clear();
-    auto items = m_dbManager->getAllItems();
+    m_listIndex.clear();
+
+    // 묶기 모드에서는 그룹마다 가장 앞선 항목만 표시 (In grouping mode, show only the first item of each group)
+    QHash<int, QListWidgetItem *> groupHeads;
+    QHash<int, int> groupSizes;
     for (const auto &item : items) {
-        QString display = item.content.left(100).replace("\n", " ");
-        if (item.content.length() > 100) display += "...";
-        
-        QListWidgetItem *listItem = new QListWidgetItem(display, m_historyList);
-        listItem->setData(Qt::UserRole, item.content);
-        listItem->setData(Qt::UserRole + 1, item.id);
+        if (m_groupSimilar && groupHeads.contains(item.groupId)) {
+            ++groupSizes[item.groupId];
+            continue;
+        }
+        QListWidgetItem *listItem = createListItem(item);
         m_historyList->addItem(listItem);
+        m_listIndex.insert(item.id, listItem);
+        if (m_groupSimilar) {
+            groupHeads.insert(item.groupId, listItem);
+            groupSizes.insert(item.groupId, 1);
+        }
+    }
+
+    for (auto it = groupSizes.constBegin(); it != groupSizes.constEnd(); ++it) {
+        if (it.value() < 2) continue;
+        QListWidgetItem *head = groupHeads.value(it.key());
+        head->setText(QString("%1  ×%2").arg(head->text()).arg(it.value()));
+        head->setToolTip(QString("유사 항목 %1개 (%1 similar items)").arg(it.value()));
+    }
+}
+
+void MainWindow::actionToggleGrouping(bool enabled) {
+    // 유사 항목 묶기 전환 (Toggle near-duplicate grouping)
+    m_groupSimilar = enabled;
+    onExternalReset();
+    m_statusLabel->setText(enabled ? "🧩 유사 항목을 묶어서 표시합니다. (Grouping similar items.)"
+                                   : "🧩 모든 항목을 표시합니다. (Showing all items.)");
+}
+
+QListWidgetItem *MainWindow::createListItem(const ClipboardItem &item) {
+    QString display = item.content.left(100).replace("\n", " ");
+    if (item.content.length() > 100) display += "...";
+    if (!item.tags.isEmpty()) display = QString("🏷️ [%1] ").arg(item.tags.join(", ")) + display;
+
+    QListWidgetItem *listItem = new QListWidgetItem(display);
+    listItem->setData(Qt::UserRole, item.content);
+    listItem->setData(Qt::UserRole + 1, item.id);
+    listItem->setData(Qt::UserRole + 2, item.isPinned);
+    listItem->setData(Qt::UserRole + 3, item.timestamp);
+    listItem->setData(Qt::UserRole + 4, item.groupId);
+    return listItem;
+}
+
+int MainWindow::insertionRow(const ClipboardItem &item) const {
+    // 고정 우선, 최신 우선 정렬을 유지하는 위치를 이진 탐색
+    // Binary-search the row that keeps the pinned-first, newest-first order
+    int lo = 0;
+    int hi = m_historyList->count();
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        QListWidgetItem *other = m_historyList->item(mid);
+        bool otherPinned = other->data(Qt::UserRole + 2).toBool();
+        QDateTime otherTime = other->data(Qt::UserRole + 3).toDateTime();
+        bool before = (otherPinned && !item.isPinned) ||
+                      (otherPinned == item.isPinned && otherTime >= item.timestamp);
+        if (before) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void MainWindow::onExternalItemsChanged(const QList<int> &ids) {
+    // 다른 프로세스의 변경을 바뀐 항목만 반영 (Apply changes from other processes item by item)
+    if (!m_searchEdit->text().isEmpty() || m_groupSimilar) {
+        onExternalReset();
+        return;
+    }
+
+    for (int id : ids) {
+        delete m_listIndex.take(id);
+
+        ClipboardItem item;
+        if (m_dbManager->getItem(id, &item)) {
+            QListWidgetItem *listItem = createListItem(item);
+            m_historyList->insertItem(insertionRow(item), listItem);
+            m_listIndex.insert(id, listItem);
+        }
+    }
+    m_statusLabel->setText("🔄 다른 창의 변경 사항을 반영했습니다. (Synced external changes.)");
+}
+
+void MainWindow::onExternalReset() {
+    if (m_searchEdit->text().isEmpty()) refreshList();
+    else onSearchChanged(m_searchEdit->text());
+}
+
+void MainWindow::onItemsExpired(const QList<int> &ids) {
+    // 삭제만 있으므로 해당 행만 제거, 묶음 표시는 그룹 개수가 바뀌므로 다시 그림
+    // Expiry only deletes, so drop those rows; grouped view is rebuilt since group counts change
+    if (m_groupSimilar) {
+        onExternalReset();
+    } else {
+        for (int id : ids) {
+            delete m_listIndex.take(id);
+        }
     }
+    m_statusLabel->setText(QString("⌛ 만료된 항목 %1개를 정리했습니다. (Removed %1 expired items.)").arg(static_cast<int>(ids.size())));
 }
 
 void MainWindow::createTrayIcon() {
@@ -288,6 +448,20 @@ void MainWindow::createTrayIcon() {
 
     m_trayMenu->addSeparator();
 
+    QAction *exportAction = m_trayMenu->addAction("📤 내보내기 (Export)");
+    connect(exportAction, &QAction::triggered, this, &MainWindow::actionExportHistory);
+    QAction *importAction = m_trayMenu->addAction("📥 가져오기 (Import)");
+    connect(importAction, &QAction::triggered, this, &MainWindow::actionImportHistory);
+
+    m_trayMenu->addSeparator();
+
+    QAction *reloadRulesAction = m_trayMenu->addAction("🛡️ 규칙 다시 불러오기 (Reload Rules)");
+    connect(reloadRulesAction, &QAction::triggered, this, &MainWindow::actionReloadRules);
+    QAction *ruleStatsAction = m_trayMenu->addAction("📊 규칙 통계 (Rule Stats)");
+    connect(ruleStatsAction, &QAction::triggered, this, &MainWindow::actionShowRuleStats);
+
+    m_trayMenu->addSeparator();
+
     QAction *quitAction = m_trayMenu->addAction("❌ 종료 (Exit)");
     connect(quitAction, &QAction::triggered, this, &MainWindow::quitApp);
 
@@ -297,9 +471,9 @@ void MainWindow::createTrayIcon() {
     m_trayIcon->show();
 }
 
-void MainWindow::onNewContent(const QString &text) {
+void MainWindow::onNewContent(const QString &text, const QStringList &tags, int ttlSeconds) {
     // 클립보드 변화 감지 시 저장 처리 (Handle storage on clipboard change)
-    m_dbManager->saveItem(text);
+    m_dbManager->saveItem(text, "text", tags, ttlSeconds);
     refreshList();
     m_statusLabel->setText("📥 새로운 클립보드 내용 감지됨. (New content captured.)");
 }
@@ -315,17 +489,7 @@ void MainWindow::onSearchChanged(const QString &text) {
     if (text.isEmpty()) {
         refreshList();
     } else {
-        m_historyList->clear();
-        auto items = m_dbManager->searchItems(text);
-        for (const auto &item : items) {
-            QString display = item.content.left(100).replace("\n", " ");
-            if (item.content.length() > 100) display += "...";
-            
-            QListWidgetItem *listItem = new QListWidgetItem(display, m_historyList);
-            listItem->setData(Qt::UserRole, item.content);
-            listItem->setData(Qt::UserRole + 1, item.id);
-            m_historyList->addItem(listItem);
-        }
+        populateList(m_dbManager->searchItems(text));
     }
 }
 
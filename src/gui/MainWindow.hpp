@@ -9,6 +9,7 @@
 #include <QToolBar>
 #include <QAction>
 #include <QLabel>
+#include <QHash>
 #include "../core/DatabaseManager.hpp"
 #include "../core/ClipboardMonitor.hpp"
 #include "../plugins/TextProcessor.hpp"
@@ -20,11 +21,14 @@ public:
     ~MainWindow();
 
 private slots:
-    void onNewContent(const QString &text);
+    void onNewContent(const QString &text, const QStringList &tags, int ttlSeconds);
     void onTrayIconActivated(QSystemTrayIcon::ActivationReason reason);
     void onSearchChanged(const QString &text);
     void onItemDoubleClicked(QListWidgetItem *item);
     void onSelectionChanged();
+    void onExternalItemsChanged(const QList<int> &ids);
+    void onExternalReset();
+    void onItemsExpired(const QList<int> &ids);
     
     // 스마트 액션 슬롯
     void actionPrettify();
@@ -32,6 +36,16 @@ private slots:
     void actionCleanText();
     void actionCopyItem();
     void actionDeleteItem();
+    void actionToggleGrouping(bool enabled);
+    void actionCompareItems();
+
+    // 히스토리 가져오기/내보내기 슬롯
+    void actionExportHistory();
+    void actionImportHistory();
+
+    // 캡처 규칙 슬롯
+    void actionReloadRules();
+    void actionShowRuleStats();
 
     void refreshList();
     void showWindow();
@@ -41,25 +55,32 @@ private:
     void setupUi();
     void createTrayIcon();
     void updateActionStates(const QString &text);
+    void populateList(const QList<ClipboardItem> &items);
+    QListWidgetItem *createListItem(const ClipboardItem &item);
+    int insertionRow(const ClipboardItem &item) const;
 
-    DatabaseManager *m_dbManager;
-    ClipboardMonitor *m_cbMonitor;
+    DatabaseManager *m_dbManager = nullptr;
+    ClipboardMonitor *m_cbMonitor = nullptr;
 
-    QSystemTrayIcon *m_trayIcon;
-    QMenu *m_trayMenu;
+    QSystemTrayIcon *m_trayIcon = nullptr;
+    QMenu *m_trayMenu = nullptr;
 
-    QLineEdit *m_searchEdit;
-    QListWidget *m_historyList;
+    QLineEdit *m_searchEdit = nullptr;
+    QListWidget *m_historyList = nullptr;
+    QHash<int, QListWidgetItem *> m_listIndex; ///< 항목 ID별 리스트 행 (List row per item ID)
     
     // 툴바 및 액션
-    QToolBar *m_toolBar;
-    QAction *m_prettifyAction;
-    QAction *m_decodeAction;
-    QAction *m_cleanAction;
-    QAction *m_copyAction;
-    QAction *m_deleteAction;
+    QToolBar *m_toolBar = nullptr;
+    QAction *m_prettifyAction = nullptr;
+    QAction *m_decodeAction = nullptr;
+    QAction *m_cleanAction = nullptr;
+    QAction *m_copyAction = nullptr;
+    QAction *m_deleteAction = nullptr;
+    QAction *m_groupAction = nullptr;
+    QAction *m_compareAction = nullptr;
+    bool m_groupSimilar = false; ///< 유사 항목 묶기 여부 (Whether near-duplicates are collapsed)
     
-    QLabel *m_statusLabel;
+    QLabel *m_statusLabel = nullptr;
 };
 
 #endif // MAINWINDOW_HPP
@@ -1,11 +1,69 @@
 #include <QApplication>
 #include <QSystemTrayIcon>
 #include <QMessageBox>
+#include <QCommandLineParser>
 #include "gui/MainWindow.hpp"
+#include "core/HistoryTransfer.hpp"
+
+// GUI 없이 실행할 가져오기/내보내기 인자가 있는지 확인
+// Check whether import/export arguments request a headless run
+static bool hasTransferArgument(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        const QByteArray arg(argv[i]);
+        if (arg.startsWith("--export") || arg.startsWith("--import")) return true;
+    }
+    return false;
+}
+
+// 명령줄 가져오기/내보내기 처리 (Command-line import/export)
+static int runTransfer(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Clipsmith");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Clipsmith history import/export");
+    parser.addHelpOption();
+    QCommandLineOption exportOption("export", "히스토리를 파일로 내보내기 (Export history to <file>)", "file");
+    QCommandLineOption importOption("import", "파일에서 히스토리 가져오기 (Import history from <file>)", "file");
+    QCommandLineOption formatOption("format", "파일 형식: jsonl | binary (File format, default by extension)", "format");
+    parser.addOption(exportOption);
+    parser.addOption(importOption);
+    parser.addOption(formatOption);
+    parser.process(app);
+
+    TransferFormat format = TransferFormat::Auto;
+    const QString formatName = parser.value(formatOption).toLower();
+    if (formatName == "jsonl") format = TransferFormat::JsonLines;
+    else if (formatName == "binary") format = TransferFormat::Binary;
+    else if (!formatName.isEmpty()) {
+        qCritical() << "알 수 없는 형식 (Unknown format):" << formatName;
+        return 2;
+    }
+
+    DatabaseManager db;
+    if (!db.init()) return 1;
+
+    if (parser.isSet(exportOption)) {
+        qint64 count = HistoryTransfer::exportHistory(&db, parser.value(exportOption), format);
+        if (count < 0) return 1;
+        qInfo() << "내보내기 완료 (Exported):" << count;
+    }
+    if (parser.isSet(importOption)) {
+        qint64 count = HistoryTransfer::importHistory(&db, parser.value(importOption), format);
+        if (count < 0) return 1;
+        qInfo() << "가져오기 완료 (Imported new):" << count;
+    }
+    return 0;
+}
 
 int main(int argc, char *argv[])
 {
+    if (hasTransferArgument(argc, argv)) {
+        return runTransfer(argc, argv);
+    }
+
     QApplication app(argc, argv);
+    QApplication::setApplicationName("Clipsmith");
 
     if (!QSystemTrayIcon::isSystemTrayAvailable()) {
         QMessageBox::critical(nullptr, "Clipsmith", "시스템 트레이를 사용할 수 없는 환경입니다.");
@@ -16,7 +74,7 @@ int main(int argc, char *argv[])
     app.setWindowIcon(QIcon(":/logo.png"));
 
     MainWindow window;
-    window.show(); 
+    window.show();
 
     return app.exec();
 }
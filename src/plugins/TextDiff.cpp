@@ -0,0 +1,409 @@
+#include "TextDiff.hpp"
+#include <QHash>
+#include <QStringList>
+#include <QStringView>
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace {
+const int kMinTooExpensive = 1024;   // 분할 비용 하한 (Lower bound on the split cost cutoff)
+const int kMaxRefineChars = 100000;  // 단어 단위로 다시 비교할 최대 묶음 크기 (Largest hunk re-compared per word)
+
+// 선형 공간 Myers 비교, GNU diff의 diag/compareseq와 같은 구조 (Linear-space Myers, structured like GNU diff's diag/compareseq)
+class MyersDiff {
+public:
+    MyersDiff(const std::vector<int> &a, const std::vector<int> &b, const std::atomic_bool *cancel)
+        : m_a(a), m_b(b), m_cancel(cancel),
+          m_removed(a.size(), 0), m_added(b.size(), 0) {
+        const int n = int(a.size());
+        const int m = int(b.size());
+        const size_t diagonals = size_t(n) + size_t(m) + 3;
+        m_forward.resize(diagonals);
+        m_backward.resize(diagonals);
+        m_offset = m + 1;
+
+        // GNU diff처럼 대각선 수의 제곱근 정도에서 비용을 끊음 (Cut off around the square root of the diagonal count, like GNU diff)
+        m_tooExpensive = 1;
+        for (size_t d = diagonals; d != 0; d >>= 2) m_tooExpensive <<= 1;
+        m_tooExpensive = std::max(kMinTooExpensive, m_tooExpensive);
+    }
+
+    bool run() {
+        compareSeq(0, int(m_a.size()), 0, int(m_b.size()));
+        return !m_cancelled;
+    }
+
+    const std::vector<char> &removed() const { return m_removed; }
+    const std::vector<char> &added() const { return m_added; }
+
+private:
+    int &fd(int diagonal) { return m_forward[size_t(diagonal + m_offset)]; }
+    int &bd(int diagonal) { return m_backward[size_t(diagonal + m_offset)]; }
+
+    bool cancelRequested() {
+        if (!m_cancelled && m_cancel && m_cancel->load(std::memory_order_relaxed)) m_cancelled = true;
+        return m_cancelled;
+    }
+
+    void markChanged(int xoff, int xlim, int yoff, int ylim) {
+        std::fill(m_removed.begin() + xoff, m_removed.begin() + xlim, 1);
+        std::fill(m_added.begin() + yoff, m_added.begin() + ylim, 1);
+    }
+
+    void compareSeq(int xoff, int xlim, int yoff, int ylim) {
+        while (xoff < xlim && yoff < ylim && m_a[size_t(xoff)] == m_b[size_t(yoff)]) { ++xoff; ++yoff; }
+        while (xoff < xlim && yoff < ylim && m_a[size_t(xlim - 1)] == m_b[size_t(ylim - 1)]) { --xlim; --ylim; }
+
+        if (xoff == xlim || yoff == ylim || cancelRequested()) {
+            markChanged(xoff, xlim, yoff, ylim);
+            return;
+        }
+
+        int xmid = 0;
+        int ymid = 0;
+        split(xoff, xlim, yoff, ylim, &xmid, &ymid);
+        if ((xmid == xoff && ymid == yoff) || (xmid == xlim && ymid == ylim)) {
+            markChanged(xoff, xlim, yoff, ylim);
+            return;
+        }
+        compareSeq(xoff, xmid, yoff, ymid);
+        compareSeq(xmid, xlim, ymid, ylim);
+    }
+
+    // 가운데 스네이크 찾기, 비용이 크면 가장 멀리 간 대각선에서 나눔 (Find the middle snake, or split at the furthest diagonal when too costly)
+    void split(int xoff, int xlim, int yoff, int ylim, int *xmid, int *ymid) {
+        const int dmin = xoff - ylim;
+        const int dmax = xlim - yoff;
+        const int fmid = xoff - yoff;
+        const int bmid = xlim - ylim;
+        int fmin = fmid, fmax = fmid;
+        int bmin = bmid, bmax = bmid;
+        const bool odd = ((fmid - bmid) & 1) != 0;
+
+        fd(fmid) = xoff;
+        bd(bmid) = xlim;
+
+        for (int cost = 1;; ++cost) {
+            if (fmin > dmin) fd(--fmin - 1) = -1; else ++fmin;
+            if (fmax < dmax) fd(++fmax + 1) = -1; else --fmax;
+            for (int d = fmax; d >= fmin; d -= 2) {
+                const int tlo = fd(d - 1);
+                const int thi = fd(d + 1);
+                int x = tlo >= thi ? tlo + 1 : thi;
+                int y = x - d;
+                while (x < xlim && y < ylim && m_a[size_t(x)] == m_b[size_t(y)]) { ++x; ++y; }
+                fd(d) = x;
+                if (odd && bmin <= d && d <= bmax && bd(d) <= x) {
+                    *xmid = x;
+                    *ymid = y;
+                    return;
+                }
+            }
+
+            if (bmin > dmin) bd(--bmin - 1) = INT_MAX; else ++bmin;
+            if (bmax < dmax) bd(++bmax + 1) = INT_MAX; else --bmax;
+            for (int d = bmax; d >= bmin; d -= 2) {
+                const int tlo = bd(d - 1);
+                const int thi = bd(d + 1);
+                int x = tlo < thi ? tlo : thi - 1;
+                int y = x - d;
+                while (xoff < x && yoff < y && m_a[size_t(x - 1)] == m_b[size_t(y - 1)]) { --x; --y; }
+                bd(d) = x;
+                if (!odd && fmin <= d && d <= fmax && x <= fd(d)) {
+                    *xmid = x;
+                    *ymid = y;
+                    return;
+                }
+            }
+
+            if (cost < m_tooExpensive && !cancelRequested()) continue;
+
+            int fxybest = -1, fxbest = xlim;
+            for (int d = fmax; d >= fmin; d -= 2) {
+                int x = std::min(fd(d), xlim);
+                int y = x - d;
+                if (ylim < y) { x = ylim + d; y = ylim; }
+                if (fxybest < x + y) { fxybest = x + y; fxbest = x; }
+            }
+            int bxybest = INT_MAX, bxbest = xoff;
+            for (int d = bmax; d >= bmin; d -= 2) {
+                int x = std::max(xoff, bd(d));
+                int y = x - d;
+                if (y < yoff) { x = yoff + d; y = yoff; }
+                if (x + y < bxybest) { bxybest = x + y; bxbest = x; }
+            }
+            if ((xlim + ylim) - bxybest < fxybest - (xoff + yoff)) {
+                *xmid = fxbest;
+                *ymid = fxybest - fxbest;
+            } else {
+                *xmid = bxbest;
+                *ymid = bxybest - bxbest;
+            }
+            return;
+        }
+    }
+
+    const std::vector<int> &m_a;
+    const std::vector<int> &m_b;
+    const std::atomic_bool *m_cancel;
+    bool m_cancelled = false;
+    std::vector<char> m_removed;
+    std::vector<char> m_added;
+    std::vector<int> m_forward;
+    std::vector<int> m_backward;
+    int m_offset = 0;
+    int m_tooExpensive = 4096;
+};
+
+// 상대편에 없는 토큰은 바로 변경으로 표시하고 나머지만 비교 (Tokens absent from the other side are marked changed up front; only the rest is compared)
+bool diffSequences(const std::vector<int> &a, const std::vector<int> &b, int idCount, const std::atomic_bool *cancel,
+                   std::vector<char> *removed, std::vector<char> *added) {
+    std::vector<int> inA(size_t(idCount), 0), inB(size_t(idCount), 0);
+    for (int id : a) inA[size_t(id)] = 1;
+    for (int id : b) inB[size_t(id)] = 1;
+
+    std::vector<int> fa, fb, mapA, mapB;
+    fa.reserve(a.size()); mapA.reserve(a.size());
+    fb.reserve(b.size()); mapB.reserve(b.size());
+    removed->assign(a.size(), 1);
+    added->assign(b.size(), 1);
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (inB[size_t(a[i])]) { fa.push_back(a[i]); mapA.push_back(int(i)); }
+    }
+    for (size_t j = 0; j < b.size(); ++j) {
+        if (inA[size_t(b[j])]) { fb.push_back(b[j]); mapB.push_back(int(j)); }
+    }
+
+    MyersDiff myers(fa, fb, cancel);
+    const bool finished = myers.run();
+    for (size_t i = 0; i < fa.size(); ++i) (*removed)[size_t(mapA[i])] = myers.removed()[i];
+    for (size_t j = 0; j < fb.size(); ++j) (*added)[size_t(mapB[j])] = myers.added()[j];
+    return finished;
+}
+
+// 원문 안의 토큰 위치 (Token position inside the source text)
+struct Token {
+    int pos;
+    int len;
+};
+
+// 줄바꿈까지 포함한 줄 단위 토큰 (Line tokens, each including its newline)
+std::vector<Token> splitLines(const QString &text, int start, int end) {
+    std::vector<Token> tokens;
+    int pos = start;
+    while (pos < end) {
+        int newline = text.indexOf(QLatin1Char('\n'), pos);
+        const int stop = (newline < 0 || newline >= end) ? end : newline + 1;
+        tokens.push_back({pos, stop - pos});
+        pos = stop;
+    }
+    return tokens;
+}
+
+// 단어, 공백 묶음, 줄바꿈, 그 밖의 문자 하나씩 (Words, whitespace runs, newlines and single other characters)
+std::vector<Token> splitWords(const QString &text, int start, int end) {
+    std::vector<Token> tokens;
+    const QChar *data = text.constData();
+    int pos = start;
+    while (pos < end) {
+        const QChar c = data[pos];
+        int stop = pos + 1;
+        if (c.isLetterOrNumber() || c == QLatin1Char('_')) {
+            while (stop < end && (data[stop].isLetterOrNumber() || data[stop] == QLatin1Char('_'))) ++stop;
+        } else if (c.isSpace() && c != QLatin1Char('\n')) {
+            while (stop < end && data[stop].isSpace() && data[stop] != QLatin1Char('\n')) ++stop;
+        }
+        tokens.push_back({pos, stop - pos});
+        pos = stop;
+    }
+    return tokens;
+}
+
+// 같은 내용의 토큰에 같은 정수 ID 부여 (Give equal tokens the same integer ID)
+class TokenTable {
+public:
+    std::vector<int> intern(const QString &text, const std::vector<Token> &tokens) {
+        std::vector<int> ids;
+        ids.reserve(tokens.size());
+        for (const Token &token : tokens) {
+            const QStringView view(text.constData() + token.pos, token.len);
+            auto it = m_ids.constFind(view);
+            if (it == m_ids.constEnd()) it = m_ids.insert(view, int(m_ids.size()));
+            ids.push_back(it.value());
+        }
+        return ids;
+    }
+
+    int size() const { return int(m_ids.size()); }
+
+private:
+    QHash<QStringView, int> m_ids;
+};
+
+void appendChunk(QVector<DiffChunk> &chunks, DiffChunk::Op op, const QString &text) {
+    if (text.isEmpty()) return;
+    if (!chunks.isEmpty() && chunks.last().op == op) {
+        chunks.last().text += text;
+        return;
+    }
+    DiffChunk chunk;
+    chunk.op = op;
+    chunk.text = text;
+    chunks.append(chunk);
+}
+
+// 토큰 위치 범위를 원문 구간으로 (Source span covered by a token range)
+QString span(const QString &text, const std::vector<Token> &tokens, size_t first, size_t last) {
+    if (first >= last) return QString();
+    const int pos = tokens[first].pos;
+    return text.mid(pos, tokens[last - 1].pos + tokens[last - 1].len - pos);
+}
+
+// 편집 표시를 따라가며 조각 생성, 삭제를 추가보다 먼저 둠 (Walk the edit marks into chunks, deletions before insertions)
+template <typename HunkHandler>
+void walkEdits(const std::vector<char> &removed, const std::vector<char> &added, HunkHandler onRun) {
+    size_t i = 0, j = 0;
+    const size_t na = removed.size();
+    const size_t nb = added.size();
+    while (i < na || j < nb) {
+        const size_t i0 = i, j0 = j;
+        while (i < na && j < nb && !removed[i] && !added[j]) { ++i; ++j; }
+        if (i > i0) onRun(DiffChunk::Equal, i0, i, j0, j);
+
+        const size_t di = i, dj = j;
+        while (i < na && removed[i]) ++i;
+        while (j < nb && added[j]) ++j;
+        if (i > di || j > dj) onRun(DiffChunk::Delete, di, i, dj, j);
+        else if (i == i0 && j == j0) break;
+    }
+}
+
+void refineWords(const QString &before, int beforeStart, int beforeEnd,
+                 const QString &after, int afterStart, int afterEnd,
+                 const std::atomic_bool *cancel, QVector<DiffChunk> &chunks, bool *cancelled) {
+    const std::vector<Token> wordsA = splitWords(before, beforeStart, beforeEnd);
+    const std::vector<Token> wordsB = splitWords(after, afterStart, afterEnd);
+    TokenTable table;
+    const std::vector<int> idsA = table.intern(before, wordsA);
+    const std::vector<int> idsB = table.intern(after, wordsB);
+
+    std::vector<char> removed, added;
+    if (!diffSequences(idsA, idsB, table.size(), cancel, &removed, &added)) {
+        *cancelled = true;
+        return;
+    }
+    walkEdits(removed, added, [&](DiffChunk::Op op, size_t i0, size_t i1, size_t j0, size_t j1) {
+        if (op == DiffChunk::Equal) {
+            appendChunk(chunks, DiffChunk::Equal, span(before, wordsA, i0, i1));
+        } else {
+            appendChunk(chunks, DiffChunk::Delete, span(before, wordsA, i0, i1));
+            appendChunk(chunks, DiffChunk::Insert, span(after, wordsB, j0, j1));
+        }
+    });
+}
+
+// 줄 목록, 끝 줄바꿈은 빈 줄로 치지 않음 (Line list; a trailing newline does not add an empty line)
+QStringList linesOf(const QString &text) {
+    QStringList lines = text.split(QLatin1Char('\n'));
+    if (text.endsWith(QLatin1Char('\n'))) lines.removeLast();
+    return lines;
+}
+
+QString foldMarker(int count) {
+    return QString("@@ 변경 없음 %1줄 (%1 unchanged lines) @@").arg(count);
+}
+}
+
+DiffResult TextDiff::compare(const QString &before, const QString &after, DiffGranularity granularity,
+                             const std::atomic_bool *cancel) {
+    DiffResult result;
+    const std::vector<Token> linesA = splitLines(before, 0, int(before.size()));
+    const std::vector<Token> linesB = splitLines(after, 0, int(after.size()));
+    TokenTable table;
+    const std::vector<int> idsA = table.intern(before, linesA);
+    const std::vector<int> idsB = table.intern(after, linesB);
+
+    std::vector<char> removed, added;
+    if (!diffSequences(idsA, idsB, table.size(), cancel, &removed, &added)) {
+        result.cancelled = true;
+        return result;
+    }
+
+    walkEdits(removed, added, [&](DiffChunk::Op op, size_t i0, size_t i1, size_t j0, size_t j1) {
+        if (result.cancelled) return;
+        if (op == DiffChunk::Equal) {
+            appendChunk(result.chunks, DiffChunk::Equal, span(before, linesA, i0, i1));
+            return;
+        }
+        result.removedLines += int(i1 - i0);
+        result.addedLines += int(j1 - j0);
+
+        const int beforeStart = i0 < i1 ? linesA[i0].pos : 0;
+        const int beforeEnd = i0 < i1 ? linesA[i1 - 1].pos + linesA[i1 - 1].len : 0;
+        const int afterStart = j0 < j1 ? linesB[j0].pos : 0;
+        const int afterEnd = j0 < j1 ? linesB[j1 - 1].pos + linesB[j1 - 1].len : 0;
+        if (granularity == DiffGranularity::Word && i0 < i1 && j0 < j1
+            && beforeEnd - beforeStart <= kMaxRefineChars && afterEnd - afterStart <= kMaxRefineChars) {
+            refineWords(before, beforeStart, beforeEnd, after, afterStart, afterEnd, cancel,
+                        result.chunks, &result.cancelled);
+        } else {
+            appendChunk(result.chunks, DiffChunk::Delete, before.mid(beforeStart, beforeEnd - beforeStart));
+            appendChunk(result.chunks, DiffChunk::Insert, after.mid(afterStart, afterEnd - afterStart));
+        }
+    });
+    if (result.cancelled) result.chunks.clear();
+    return result;
+}
+
+QString TextDiff::render(const DiffResult &result, DiffGranularity granularity, int contextLines) {
+    QString out;
+    const int count = int(result.chunks.size());
+    for (int c = 0; c < count; ++c) {
+        const DiffChunk &chunk = result.chunks.at(c);
+        const bool first = c == 0;
+        const bool last = c == count - 1;
+
+        if (granularity == DiffGranularity::Line) {
+            const QStringList lines = linesOf(chunk.text);
+            if (chunk.op != DiffChunk::Equal) {
+                const QString prefix = chunk.op == DiffChunk::Delete ? "- " : "+ ";
+                for (const QString &line : lines) out += prefix + line + '\n';
+                continue;
+            }
+            const int head = first ? 0 : contextLines;
+            const int tail = last ? 0 : contextLines;
+            const int total = int(lines.size());
+            if (total <= head + tail + 1) {
+                for (const QString &line : lines) out += "  " + line + '\n';
+                continue;
+            }
+            for (int i = 0; i < head; ++i) out += "  " + lines.at(i) + '\n';
+            out += foldMarker(total - head - tail) + '\n';
+            for (int i = total - tail; i < total; ++i) out += "  " + lines.at(i) + '\n';
+            continue;
+        }
+
+        if (chunk.op == DiffChunk::Delete) {
+            out += "[-" + chunk.text + "-]";
+        } else if (chunk.op == DiffChunk::Insert) {
+            out += "{+" + chunk.text + "+}";
+        } else {
+            // 바뀐 곳과 같은 줄에 있는 앞뒤 조각은 항상 남김 (Partial lines adjoining a change are always kept)
+            QStringList pieces = chunk.text.split(QLatin1Char('\n'));
+            if (last && chunk.text.endsWith(QLatin1Char('\n'))) pieces.removeLast();
+            const int head = first ? 0 : contextLines + 1;
+            const int tail = last ? 0 : contextLines + 1;
+            const int total = int(pieces.size());
+            if (total <= head + tail + 1) {
+                out += chunk.text;
+                continue;
+            }
+            for (int i = 0; i < head; ++i) out += pieces.at(i) + '\n';
+            out += foldMarker(total - head - tail);
+            for (int i = total - tail; i < total; ++i) out += '\n' + pieces.at(i);
+            if (tail == 0) out += '\n';
+        }
+    }
+    return out;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file TextDiff.hpp
+ * @brief 텍스트 비교 유틸리티 클래스 (Text Comparison Utility Class)
+ *
+ * 선형 공간 Myers 알고리즘으로 두 텍스트의 줄/단어 단위 차이를 계산합니다.
+ * Computes line- and word-level differences between two texts with the linear-space Myers algorithm.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef TEXTDIFF_HPP
+#define TEXTDIFF_HPP
+
+#include <QString>
+#include <QVector>
+#include <atomic>
+
+/**
+ * @enum DiffGranularity
+ * @brief 비교 단위 (Comparison granularity)
+ */
+enum class DiffGranularity {
+    Line, ///< 줄 단위 (Per line)
+    Word  ///< 바뀐 줄 안에서 단어 단위 (Per word inside changed lines)
+};
+
+/**
+ * @struct DiffChunk
+ * @brief 같은 종류의 연속된 차이 조각 (A run of tokens with the same operation)
+ */
+struct DiffChunk {
+    enum Op { Equal, Delete, Insert };
+    Op op = Equal;  ///< 조각 종류 (Operation)
+    QString text;   ///< 원문 그대로의 내용 (Verbatim text)
+};
+
+/**
+ * @struct DiffResult
+ * @brief 비교 결과 (Comparison result)
+ */
+struct DiffResult {
+    QVector<DiffChunk> chunks; ///< 앞 텍스트에서 뒤 텍스트로의 편집 순서 (Edit script from before to after)
+    int addedLines = 0;        ///< 추가된 줄 수 (Lines added)
+    int removedLines = 0;      ///< 삭제된 줄 수 (Lines removed)
+    bool cancelled = false;    ///< 취소 여부 (Whether the comparison was cancelled)
+};
+
+/**
+ * @class TextDiff
+ * @brief 텍스트 비교 엔진 (Text Comparison Engine)
+ *
+ * 줄은 정수 ID로 바꿔 비교하고, 공통 앞뒤 부분은 먼저 잘라냅니다. 편집 거리가 너무 커지면
+ * 최소 편집 대신 가장 멀리 나아간 대각선에서 나누어 수 MB 입력에서도 시간이 제한됩니다.
+ * 단어 단위는 바뀐 줄 묶음 안에서만 다시 비교합니다.
+ * Lines are interned to integer IDs and the common prefix and suffix are trimmed first. When the edit
+ * distance grows too large, the split falls back to the furthest-reaching diagonal instead of the minimal
+ * edit, which bounds the time on multi-megabyte inputs. Word granularity re-compares only changed hunks.
+ */
+class TextDiff {
+public:
+    /**
+     * @brief 두 텍스트 비교 (Compare two texts)
+     * @param before 이전 텍스트 (Earlier text)
+     * @param after 이후 텍스트 (Later text)
+     * @param granularity 비교 단위 (Granularity)
+     * @param cancel 다른 스레드에서 설정하는 취소 플래그 (Cancel flag set from another thread)
+     * @return 비교 결과 (Result)
+     */
+    static DiffResult compare(const QString &before, const QString &after, DiffGranularity granularity,
+                              const std::atomic_bool *cancel = nullptr);
+
+    /**
+     * @brief 결과를 읽기 쉬운 텍스트로 변환 (Render a result as readable text)
+     *
+     * 줄 단위는 "+ ", "- ", "  " 접두어, 단어 단위는 [-삭제-]{+추가+} 표기를 씁니다.
+     * 바뀌지 않은 긴 구간은 앞뒤 contextLines 줄만 남기고 접습니다.
+     * Line granularity uses "+ ", "- " and "  " prefixes; word granularity uses [-removed-]{+added+}.
+     * Long unchanged stretches are folded to contextLines lines on each side.
+     * @param result 비교 결과 (Result)
+     * @param granularity 비교 단위 (Granularity)
+     * @param contextLines 접을 때 남길 줄 수 (Lines kept around folds)
+     * @return 표시용 텍스트 (Display text)
+     */
+    static QString render(const DiffResult &result, DiffGranularity granularity, int contextLines = 3);
+};
+
+#endif // TEXTDIFF_HPP
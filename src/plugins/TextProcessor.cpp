@@ -5,6 +5,22 @@
 #include <QByteArray>
 #include <QRegularExpression>
 
+namespace {
+// 특징 해시 (Feature hash, FNV-1a 64)
+quint64 featureHash(const QString &feature) {
+    quint64 hash = 14695981039346656037ULL;
+    for (QChar ch : feature) {
+        hash ^= ch.unicode();
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// 지문 계산에 사용할 최대 길이 (Maximum length considered for fingerprints)
+const int kSimHashMaxChars = 256 * 1024;
+const int kSimHashMinTokens = 3;
+}
+
 TextType TextProcessor::detectType(const QString &text) {
     QString trimmed = text.trimmed();
     
@@ -34,12 +50,21 @@ TextType TextProcessor::detectType(const QString &text) {
 }
 
 QString TextProcessor::prettifyJson(const QString &json) {
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(json.toUtf8(), &error);
-    if (error.error != QJsonParseError::NoError) {
+    QString result;
+    if (!normalizeJson(json, &result)) {
         return "Invalid JSON";
     }
-    return doc.toJson(QJsonDocument::Indented);
+    return result;
+}
+
+bool TextProcessor::normalizeJson(const QString &text, QString *normalized) {
+    const QString trimmed = text.trimmed();
+    if (!trimmed.startsWith('{') && !trimmed.startsWith('[')) return false;
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(trimmed.toUtf8(), &error);
+    if (error.error != QJsonParseError::NoError) return false;
+    *normalized = QString::fromUtf8(doc.toJson(QJsonDocument::Indented));
+    return true;
 }
 
 QString TextProcessor::toBase64(const QString &text) {
@@ -57,3 +82,50 @@ QString TextProcessor::cleanText(const QString &text) {
     cleaned = cleaned.replace(QRegularExpression("\\s+"), " ");
     return cleaned;
 }
+
+quint64 TextProcessor::simHash(const QString &text) {
+    // 단어와 단어 쌍을 특징으로 사용 (Words and word pairs are the features)
+    int weights[64] = {0};
+    int tokens = 0;
+    QString token;
+    QString previous;
+
+    auto addFeature = [&weights](const QString &feature) {
+        const quint64 hash = featureHash(feature);
+        for (int bit = 0; bit < 64; ++bit) {
+            weights[bit] += (hash >> bit) & 1 ? 1 : -1;
+        }
+    };
+    auto flushToken = [&]() {
+        if (token.isEmpty()) return;
+        addFeature(token);
+        if (!previous.isEmpty()) addFeature(previous + QLatin1Char(' ') + token);
+        previous = token;
+        token.clear();
+        ++tokens;
+    };
+
+    // 숫자열은 길이와 무관하게 0 하나로 접음 (Digit runs collapse to a single 0 regardless of length)
+    const int length = qMin(text.size(), kSimHashMaxChars);
+    bool inDigits = false;
+    for (int i = 0; i < length; ++i) {
+        const QChar ch = text.at(i);
+        if (ch.isDigit()) {
+            if (!inDigits) token += QLatin1Char('0');
+            inDigits = true;
+            continue;
+        }
+        inDigits = false;
+        if (ch.isLetter()) token += ch.toLower();
+        else flushToken();
+    }
+    flushToken();
+
+    if (tokens < kSimHashMinTokens) return 0;
+
+    quint64 result = 0;
+    for (int bit = 0; bit < 64; ++bit) {
+        if (weights[bit] > 0) result |= quint64(1) << bit;
+    }
+    return result;
+}
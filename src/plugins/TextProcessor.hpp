@@ -46,6 +46,17 @@ public:
      */
     static QString prettifyJson(const QString &json);
 
+    /**
+     * @brief JSON이면 키 정렬된 들여쓰기 형태로 정규화 (Normalize to key-sorted indented form if the text is JSON)
+     *
+     * 한 번만 파싱하므로 detectType 후 prettifyJson을 부르는 것보다 쌉니다.
+     * Parses only once, so it is cheaper than detectType followed by prettifyJson.
+     * @param text 원문 (Original text)
+     * @param normalized 정규화된 JSON을 받을 문자열 (Receives the normalized JSON)
+     * @return JSON이면 true (True if the text is JSON)
+     */
+    static bool normalizeJson(const QString &text, QString *normalized);
+
     /**
      * @brief 텍스트를 Base64로 인코딩 (Encode text to Base64)
      * @param text 원문 (Original text)
@@ -66,6 +77,16 @@ public:
      * @return 정리된 텍스트 (Cleaned text)
      */
     static QString cleanText(const QString &text);
+
+    /**
+     * @brief 유사 중복 검출용 64비트 SimHash (64-bit SimHash for near-duplicate detection)
+     *
+     * 숫자열은 0으로 정규화하므로 시간이나 ID만 다른 로그 줄은 같은 지문을 가집니다.
+     * Digit runs are normalized to 0, so log lines differing only in timestamps or IDs share a fingerprint.
+     * @param text 원문 (Original text)
+     * @return 지문, 특징이 너무 적으면 0 (Fingerprint, 0 when there are too few features)
+     */
+    static quint64 simHash(const QString &text);
 };
 
 #endif // TEXTPROCESSOR_HPP
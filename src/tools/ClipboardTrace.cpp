@@ -0,0 +1,230 @@
+#include "ClipboardTrace.hpp"
+#include <QFile>
+#include <QImage>
+#include <QColor>
+#include <QUrl>
+#include <QList>
+#include <QStringList>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QRandomGenerator>
+#include <QDebug>
+#include <cmath>
+
+namespace {
+const char *const kWords[] = {
+    "clip", "smith", "buffer", "request", "server", "latency", "commit", "branch", "value", "index",
+    "render", "widget", "config", "token", "stream", "socket", "thread", "cache", "query", "report",
+    "안녕하세요", "클립보드", "기록", "검색", "설정"
+};
+const int kWordCount = int(sizeof(kWords) / sizeof(kWords[0]));
+
+// 일련번호로 시작해 서로 다른 내용을 size 길이만큼 채움 (Fill size characters, prefixed by a serial so payloads differ)
+QString synthesizeText(QRandomGenerator &rng, int size, int serial) {
+    QString text = QString("#%1 ").arg(serial);
+    text.reserve(size + 16);
+    int column = 0;
+    while (text.size() < size) {
+        if (rng.bounded(8) == 0) {
+            text += QString::number(rng.bounded(100000));
+        } else {
+            text += QString::fromUtf8(kWords[rng.bounded(kWordCount)]);
+        }
+        column += 8;
+        if (column > 72) {
+            text += '\n';
+            column = 0;
+        } else {
+            text += ' ';
+        }
+    }
+    text.truncate(qMax(size, 1));
+    return text;
+}
+
+QString synthesizeUrls(QRandomGenerator &rng, int size, int serial) {
+    QStringList urls;
+    int length = 0;
+    do {
+        const QString url = QString("file:///tmp/clipsmith-replay/%1/%2-%3.txt")
+                                .arg(serial).arg(QString::fromUtf8(kWords[rng.bounded(kWordCount)])).arg(urls.size());
+        length += url.size() + 1;
+        urls << url;
+    } while (length < size);
+    return urls.join('\n');
+}
+
+TraceMime pickMime(QRandomGenerator &rng, const SyntheticProfile &profile) {
+    const int total = profile.textWeight + profile.htmlWeight + profile.urlWeight + profile.imageWeight;
+    if (total <= 0) return TraceMime::Text;
+    int pick = rng.bounded(total);
+    if ((pick -= profile.textWeight) < 0) return TraceMime::Text;
+    if ((pick -= profile.htmlWeight) < 0) return TraceMime::Html;
+    if ((pick -= profile.urlWeight) < 0) return TraceMime::Urls;
+    return TraceMime::Image;
+}
+
+int imageSideFor(int size) {
+    return qBound(8, int(std::sqrt(double(size))) * 4, 2048);
+}
+
+void fillEvent(TraceEvent &event, QRandomGenerator &rng, int size, int serial) {
+    if (event.mime == TraceMime::Image) {
+        event.imageSide = imageSideFor(size);
+    } else if (event.mime == TraceMime::Urls) {
+        event.text = synthesizeUrls(rng, size, serial);
+    } else {
+        event.text = synthesizeText(rng, size, serial);
+    }
+}
+
+bool parseMime(const QString &name, TraceMime *mime) {
+    if (name.isEmpty() || name == "text") *mime = TraceMime::Text;
+    else if (name == "html") *mime = TraceMime::Html;
+    else if (name == "urls") *mime = TraceMime::Urls;
+    else if (name == "image") *mime = TraceMime::Image;
+    else return false;
+    return true;
+}
+}
+
+QVector<TraceEvent> ClipboardTrace::generate(const SyntheticProfile &profile) {
+    QRandomGenerator rng(profile.seed);
+    QVector<TraceEvent> events;
+    events.reserve(qMax(profile.count, 0));
+
+    const double intervalMs = profile.rate > 0 ? 1000.0 / profile.rate : 0.0;
+    const double logMin = std::log(double(qMax(profile.minSize, 1)));
+    const double logMax = std::log(double(qMax(profile.maxSize, qMax(profile.minSize, 1))));
+    double clock = 0.0;
+
+    for (int i = 0; i < profile.count; ++i) {
+        if (i > 0) {
+            clock += intervalMs;
+            if (profile.burstSize > 0 && i % profile.burstSize == 0) clock += profile.burstGapMs;
+        }
+
+        TraceEvent event;
+        event.atMs = qint64(clock);
+        if (!events.isEmpty() && rng.generateDouble() < profile.duplicateRatio) {
+            // 예전 내용을 다시 복사 (Re-copy an earlier payload)
+            const TraceEvent &earlier = events.at(rng.bounded(int(events.size())));
+            event.mime = earlier.mime;
+            event.text = earlier.text;
+            event.imageSide = earlier.imageSide;
+        } else {
+            event.mime = pickMime(rng, profile);
+            const int size = int(std::exp(logMin + rng.generateDouble() * (logMax - logMin)));
+            fillEvent(event, rng, size, i);
+        }
+        events.append(event);
+    }
+    return events;
+}
+
+bool ClipboardTrace::load(const QString &path, QVector<TraceEvent> *events) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "트레이스 파일 열기 실패:" << file.errorString();
+        return false;
+    }
+
+    events->clear();
+    int lineNumber = 0;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine().trimmed();
+        ++lineNumber;
+        if (line.isEmpty()) continue;
+
+        QJsonParseError error;
+        const QJsonDocument doc = QJsonDocument::fromJson(line, &error);
+        if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+            qDebug() << "트레이스 JSON 파싱 실패 (line" << lineNumber << "):" << error.errorString();
+            return false;
+        }
+        const QJsonObject obj = doc.object();
+
+        TraceEvent event;
+        event.atMs = qint64(obj.value("at").toDouble());
+        if (!parseMime(obj.value("mime").toString(), &event.mime)) {
+            qDebug() << "알 수 없는 트레이스 MIME (line" << lineNumber << "):" << obj.value("mime").toString();
+            return false;
+        }
+        event.text = obj.value("text").toString();
+        if (event.mime == TraceMime::Image) {
+            event.imageSide = qBound(1, obj.value("size").toInt(64), 4096);
+        } else if (event.text.isEmpty()) {
+            // 크기만 기록된 이벤트는 줄 번호를 시드로 내용을 합성 (Size-only events get content seeded by line number)
+            QRandomGenerator rng(quint32(lineNumber));
+            fillEvent(event, rng, qMax(obj.value("size").toInt(), 1), lineNumber);
+        }
+        events->append(event);
+    }
+    return true;
+}
+
+bool ClipboardTrace::save(const QString &path, const QVector<TraceEvent> &events, bool withContent) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << "트레이스 파일 쓰기 실패:" << file.errorString();
+        return false;
+    }
+
+    for (const TraceEvent &event : events) {
+        QJsonObject obj;
+        obj.insert("at", double(event.atMs));
+        obj.insert("mime", mimeName(event.mime));
+        if (event.mime == TraceMime::Image) {
+            obj.insert("size", event.imageSide);
+        } else {
+            obj.insert("size", int(event.text.size()));
+            if (withContent) obj.insert("text", event.text);
+        }
+        QByteArray line = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+        line.append('\n');
+        if (file.write(line) != line.size()) {
+            qDebug() << "트레이스 쓰기 실패:" << file.errorString();
+            return false;
+        }
+    }
+    return true;
+}
+
+QMimeData *ClipboardTrace::toMimeData(const TraceEvent &event) {
+    QMimeData *data = new QMimeData;
+    switch (event.mime) {
+    case TraceMime::Text:
+        data->setText(event.text);
+        break;
+    case TraceMime::Html:
+        data->setHtml("<html><body><p>" + event.text.toHtmlEscaped() + "</p></body></html>");
+        data->setText(event.text);
+        break;
+    case TraceMime::Urls: {
+        QList<QUrl> urls;
+        for (const QString &line : event.text.split('\n')) {
+            if (!line.isEmpty()) urls << QUrl(line);
+        }
+        data->setUrls(urls);
+        break;
+    }
+    case TraceMime::Image: {
+        QImage image(event.imageSide, event.imageSide, QImage::Format_RGB32);
+        image.fill(QColor::fromHsv(event.imageSide % 360, 160, 220));
+        data->setImageData(image);
+        break;
+    }
+    }
+    return data;
+}
+
+QString ClipboardTrace::mimeName(TraceMime mime) {
+    switch (mime) {
+    case TraceMime::Html: return "html";
+    case TraceMime::Urls: return "urls";
+    case TraceMime::Image: return "image";
+    case TraceMime::Text: break;
+    }
+    return "text";
+}
@@ -0,0 +1,108 @@
+/**
+ * @file ClipboardTrace.hpp
+ * @brief 클립보드 부하 트레이스 생성/저장 클래스 (Clipboard Load Trace Generation and Storage Class)
+ *
+ * 재생 하네스가 클립보드에 넣을 이벤트 목록을 합성하거나 JSON Lines 파일로 읽고 씁니다.
+ * Synthesizes, reads and writes the event lists the replay harness pushes onto the clipboard.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef CLIPBOARDTRACE_HPP
+#define CLIPBOARDTRACE_HPP
+
+#include <QString>
+#include <QVector>
+#include <QMimeData>
+
+/**
+ * @enum TraceMime
+ * @brief 이벤트가 클립보드에 올리는 데이터 종류 (Kind of data an event puts on the clipboard)
+ */
+enum class TraceMime {
+    Text,  ///< text/plain
+    Html,  ///< text/html + text/plain (브라우저 복사 / browser copy)
+    Urls,  ///< text/uri-list (파일 관리자 복사 / file manager copy)
+    Image  ///< image/* (스크린샷 / screenshot)
+};
+
+/**
+ * @struct TraceEvent
+ * @brief 트레이스의 클립보드 변경 한 건 (One clipboard change in a trace)
+ */
+struct TraceEvent {
+    qint64 atMs = 0;                  ///< 재생 시작 기준 시각 (Offset from replay start)
+    TraceMime mime = TraceMime::Text; ///< 데이터 종류 (Data kind)
+    QString text;                     ///< 내용, 이미지는 비어 있음 (Payload, empty for images)
+    int imageSide = 0;                ///< 이미지 한 변 길이 (Image side length)
+};
+
+/**
+ * @struct SyntheticProfile
+ * @brief 합성 트레이스 설정 (Synthetic trace settings)
+ */
+struct SyntheticProfile {
+    int count = 1000;            ///< 이벤트 수 (Number of events)
+    double rate = 50.0;          ///< 버스트 안의 초당 이벤트 수, 0이면 최대 속도 (Events per second inside a burst, 0 floods)
+    int burstSize = 1;           ///< 버스트당 이벤트 수 (Events per burst)
+    int burstGapMs = 0;          ///< 버스트 사이 추가 대기 (Extra pause between bursts)
+    int minSize = 16;            ///< 최소 내용 길이 (Minimum payload length)
+    int maxSize = 4096;          ///< 최대 내용 길이, 로그 균등 분포 (Maximum payload length, log-uniform)
+    double duplicateRatio = 0.05; ///< 이전 내용을 다시 복사하는 비율 (Share of re-copied earlier payloads)
+    int textWeight = 80;         ///< text/plain 비중 (text/plain weight)
+    int htmlWeight = 10;         ///< text/html 비중 (text/html weight)
+    int urlWeight = 5;           ///< text/uri-list 비중 (text/uri-list weight)
+    int imageWeight = 5;         ///< 이미지 비중 (Image weight)
+    quint32 seed = 1;            ///< 난수 시드 (Random seed)
+};
+
+/**
+ * @class ClipboardTrace
+ * @brief 트레이스 유틸리티 (Trace Utilities)
+ *
+ * 파일 형식은 줄마다 {"at": ms, "mime": "text|html|urls|image", "text": "...", "size": n} 입니다.
+ * "text"가 없으면 "size" 길이의 내용을 합성하므로, 내용 없이 크기와 시각만 기록한 트레이스도 재생할 수 있습니다.
+ * Each line is {"at": ms, "mime": "text|html|urls|image", "text": "...", "size": n}. Without "text",
+ * a payload of "size" characters is synthesized, so traces recorded with sizes and timing only still replay.
+ */
+class ClipboardTrace {
+public:
+    /**
+     * @brief 설정에 따라 트레이스 합성 (Synthesize a trace from a profile)
+     * @param profile 합성 설정 (Synthetic settings)
+     * @return 시각 순 이벤트 목록 (Events in time order)
+     */
+    static QVector<TraceEvent> generate(const SyntheticProfile &profile);
+
+    /**
+     * @brief JSON Lines 트레이스 읽기 (Read a JSON Lines trace)
+     * @param path 파일 경로 (File path)
+     * @param events 읽은 이벤트 (Events read)
+     * @return 성공 여부 (Success or failure)
+     */
+    static bool load(const QString &path, QVector<TraceEvent> *events);
+
+    /**
+     * @brief JSON Lines 트레이스 쓰기 (Write a JSON Lines trace)
+     * @param path 파일 경로 (File path)
+     * @param events 이벤트 목록 (Events)
+     * @param withContent 내용까지 기록할지 여부, 아니면 크기만 (Whether to store payloads or only sizes)
+     * @return 성공 여부 (Success or failure)
+     */
+    static bool save(const QString &path, const QVector<TraceEvent> &events, bool withContent = true);
+
+    /**
+     * @brief 이벤트를 클립보드용 MIME 데이터로 변환 (Convert an event into clipboard MIME data)
+     * @param event 이벤트 (Event)
+     * @return 새 QMimeData, 소유권은 호출자에게 (New QMimeData owned by the caller)
+     */
+    static QMimeData *toMimeData(const TraceEvent &event);
+
+    /**
+     * @brief 데이터 종류 이름 (Name of a data kind)
+     */
+    static QString mimeName(TraceMime mime);
+};
+
+#endif // CLIPBOARDTRACE_HPP
@@ -0,0 +1,184 @@
+#include "ReplayHarness.hpp"
+#include <QApplication>
+#include <QClipboard>
+#include <QTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QSet>
+#include <QStringList>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+#include <algorithm>
+#include <memory>
+#include "../core/DatabaseManager.hpp"
+#include "../core/CaptureRuleEngine.hpp"
+
+namespace {
+const QString kVerifyConnection = QStringLiteral("clipsmith-replay-verify");
+
+// /proc/self/status 값 읽기, 리눅스가 아니면 -1 (Read a /proc/self/status field, -1 off Linux)
+qint64 procStatusKb(const QByteArray &field) {
+    QFile file("/proc/self/status");
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) return -1;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine();
+        if (line.startsWith(field + ':')) {
+            return line.mid(field.size() + 1).trimmed().split(' ').value(0).toLongLong();
+        }
+    }
+    return -1;
+}
+}
+
+double ReplayReport::percentile(double p) const {
+    if (latencyMs.isEmpty()) return 0.0;
+    QVector<double> sorted = latencyMs;
+    std::sort(sorted.begin(), sorted.end());
+    const int rank = qBound(0, int(p / 100.0 * (sorted.size() - 1) + 0.5), int(sorted.size()) - 1);
+    return sorted.at(rank);
+}
+
+QString ReplayReport::summary() const {
+    QStringList lines;
+    lines << QString("events       : %1 sent, %2 with text, %3 skipped by rules").arg(sent).arg(withText).arg(skippedByRules);
+    lines << QString("capture      : %1 / %2 unique payloads stored, %3 lost, %4 rows")
+                 .arg(captured).arg(expected).arg(lost()).arg(dbRows);
+    lines << QString("notifications: %1 (%2 events coalesced)").arg(notifications).arg(coalesced);
+    lines << QString("latency (ms) : p50 %1  p90 %2  p99 %3  max %4")
+                 .arg(percentile(50), 0, 'f', 2).arg(percentile(90), 0, 'f', 2)
+                 .arg(percentile(99), 0, 'f', 2).arg(percentile(100), 0, 'f', 2);
+    lines << QString("schedule     : %1 ms wall, worst send lag %2 ms, %3 events/s")
+                 .arg(wallMs, 0, 'f', 0).arg(maxLagMs, 0, 'f', 2)
+                 .arg(wallMs > 0 ? sent * 1000.0 / wallMs : 0.0, 0, 'f', 1);
+    lines << QString("memory (KiB) : rss %1 -> %2 (%3%4), peak %5")
+                 .arg(rssBeforeKb).arg(rssAfterKb).arg(rssAfterKb >= rssBeforeKb ? QStringLiteral("+") : QString())
+                 .arg(rssAfterKb - rssBeforeKb).arg(rssPeakKb);
+    lines << QString("database     : %1 KiB (db + wal + shm)").arg(dbBytes / 1024);
+    return lines.join('\n');
+}
+
+QJsonObject ReplayReport::toJson() const {
+    QJsonObject obj;
+    obj.insert("sent", sent);
+    obj.insert("withText", withText);
+    obj.insert("skippedByRules", skippedByRules);
+    obj.insert("expected", expected);
+    obj.insert("captured", captured);
+    obj.insert("lost", lost());
+    obj.insert("dbRows", dbRows);
+    obj.insert("notifications", notifications);
+    obj.insert("coalesced", coalesced);
+    obj.insert("wallMs", wallMs);
+    obj.insert("maxLagMs", maxLagMs);
+    obj.insert("p50Ms", percentile(50));
+    obj.insert("p90Ms", percentile(90));
+    obj.insert("p99Ms", percentile(99));
+    obj.insert("maxMs", percentile(100));
+    obj.insert("rssBeforeKb", double(rssBeforeKb));
+    obj.insert("rssAfterKb", double(rssAfterKb));
+    obj.insert("rssPeakKb", double(rssPeakKb));
+    obj.insert("dbBytes", double(dbBytes));
+    return obj;
+}
+
+ReplayHarness::ReplayHarness(const QVector<TraceEvent> &events, int settleMs, QObject *parent)
+    : QObject(parent), m_events(events), m_settleMs(settleMs) {
+    connect(QApplication::clipboard(), &QClipboard::dataChanged, this, &ReplayHarness::onClipboardChanged);
+}
+
+void ReplayHarness::start() {
+    m_report = ReplayReport();
+    m_report.rssBeforeKb = procStatusKb("VmRSS");
+    m_next = 0;
+    m_clock.start();
+    scheduleNext();
+}
+
+void ReplayHarness::scheduleNext() {
+    if (m_next >= m_events.size()) {
+        QTimer::singleShot(m_settleMs, this, &ReplayHarness::finish);
+        return;
+    }
+    // 늦었더라도 0ms 타이머로 이벤트 루프를 한 번 돌려 화면 갱신 비용이 처리량에 반영되게 함
+    // Even when behind, go through a 0 ms timer so repaint cost still counts against throughput
+    const qint64 delay = m_events.at(m_next).atMs - m_clock.elapsed();
+    QTimer::singleShot(int(qMax<qint64>(0, delay)), Qt::PreciseTimer, this, &ReplayHarness::sendNext);
+}
+
+void ReplayHarness::sendNext() {
+    const TraceEvent &event = m_events.at(m_next);
+    const qint64 dueNs = event.atMs * 1000000;
+    m_report.maxLagMs = qMax(m_report.maxLagMs, (m_clock.nsecsElapsed() - dueNs) / 1e6);
+
+    m_inFlightDueNs = dueNs;
+    ++m_unacked;
+    ++m_report.sent;
+    ++m_next;
+    // 클립보드가 QMimeData 소유권을 가져감 (The clipboard takes ownership of the QMimeData)
+    QApplication::clipboard()->setMimeData(ClipboardTrace::toMimeData(event));
+    scheduleNext();
+}
+
+void ReplayHarness::onClipboardChanged() {
+    ++m_report.notifications;
+    if (m_inFlightDueNs < 0) return;
+    m_report.latencyMs.append((m_clock.nsecsElapsed() - m_inFlightDueNs) / 1e6);
+    m_report.coalesced += m_unacked - 1;
+    m_unacked = 0;
+    m_inFlightDueNs = -1;
+}
+
+void ReplayHarness::finish() {
+    m_report.wallMs = m_clock.nsecsElapsed() / 1e6 - m_settleMs;
+    m_report.coalesced += m_unacked;
+    m_report.rssAfterKb = procStatusKb("VmRSS");
+    m_report.rssPeakKb = procStatusKb("VmHWM");
+    verify();
+    emit finished();
+}
+
+void ReplayHarness::verify() {
+    // ClipboardMonitor와 같은 판단으로 저장되어야 할 내용 계산 (Derive expected payloads the same way ClipboardMonitor does)
+    CaptureRuleEngine rules;
+    rules.load(CaptureRuleEngine::rulesPath());
+    QSet<QString> expected;
+    for (const TraceEvent &event : m_events) {
+        std::unique_ptr<QMimeData> mime(ClipboardTrace::toMimeData(event));
+        if (!mime->hasText()) continue;
+        const QString text = mime->text();
+        if (text.isEmpty()) continue;
+        ++m_report.withText;
+        const CaptureDecision decision = rules.evaluate(text);
+        if (decision.skip) {
+            ++m_report.skippedByRules;
+            continue;
+        }
+        expected.insert(decision.text);
+    }
+    m_report.expected = expected.size();
+
+    const QString path = DatabaseManager::databasePath();
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", kVerifyConnection);
+        db.setDatabaseName(path);
+        if (!db.open()) {
+            qDebug() << "검증용 DB 열기 실패:" << db.lastError().text();
+        } else {
+            QSqlQuery query(db);
+            query.setForwardOnly(true);
+            if (!query.exec("SELECT content FROM clipboard_history")) {
+                qDebug() << "검증 조회 실패:" << query.lastError().text();
+            }
+            while (query.next()) {
+                ++m_report.dbRows;
+                if (expected.remove(query.value(0).toString())) ++m_report.captured;
+            }
+        }
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(kVerifyConnection);
+
+    m_report.dbBytes = QFileInfo(path).size() + QFileInfo(path + "-wal").size() + QFileInfo(path + "-shm").size();
+}
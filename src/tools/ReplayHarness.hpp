@@ -0,0 +1,113 @@
+/**
+ * @file ReplayHarness.hpp
+ * @brief 클립보드 부하 재생 하네스 클래스 (Clipboard Load Replay Harness Class)
+ *
+ * 실제 MainWindow가 떠 있는 상태에서 트레이스를 시각에 맞춰 클립보드에 넣고,
+ * 캡처 손실, 지연 시간, 메모리 증가, DB 크기를 측정합니다.
+ * Pushes a trace onto the clipboard on schedule while a real MainWindow is running, and
+ * measures capture loss, latency, memory growth and database size.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#ifndef REPLAYHARNESS_HPP
+#define REPLAYHARNESS_HPP
+
+#include <QObject>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include "ClipboardTrace.hpp"
+
+/**
+ * @struct ReplayReport
+ * @brief 재생 결과 (Replay results)
+ */
+struct ReplayReport {
+    int sent = 0;            ///< 클립보드에 넣은 이벤트 수 (Events pushed to the clipboard)
+    int withText = 0;        ///< 텍스트가 있는 이벤트 수 (Events carrying text)
+    int skippedByRules = 0;  ///< Skip 규칙에 걸린 이벤트 수 (Events dropped by Skip rules)
+    int expected = 0;        ///< DB에 있어야 할 고유 내용 수 (Unique payloads that should be stored)
+    int captured = 0;        ///< 실제로 저장된 기대 내용 수 (Expected payloads actually stored)
+    int dbRows = 0;          ///< 최종 DB 행 수 (Final database rows)
+    int notifications = 0;   ///< 클립보드 변경 알림 수 (Clipboard change notifications)
+    int coalesced = 0;       ///< 알림 전에 덮어쓰인 이벤트 수 (Events overwritten before a notification)
+    double wallMs = 0.0;     ///< 재생 소요 시간 (Replay wall time)
+    double maxLagMs = 0.0;   ///< 예정 시각 대비 최대 전송 지연 (Worst send delay behind schedule)
+    QVector<double> latencyMs; ///< 예정 시각부터 캡처 완료까지 (Scheduled time to capture completion)
+    qint64 rssBeforeKb = -1; ///< 재생 전 RSS (RSS before replay)
+    qint64 rssAfterKb = -1;  ///< 재생 후 RSS (RSS after replay)
+    qint64 rssPeakKb = -1;   ///< 최대 RSS (Peak RSS)
+    qint64 dbBytes = 0;      ///< DB + WAL + SHM 크기 (Database, WAL and SHM size)
+
+    /// 손실된 기대 내용 수 (Expected payloads that were lost)
+    int lost() const { return expected - captured; }
+
+    /**
+     * @brief 지연 시간 백분위수 (Latency percentile)
+     * @param p 0~100
+     * @return 밀리초, 측정값이 없으면 0 (Milliseconds, 0 without samples)
+     */
+    double percentile(double p) const;
+
+    /// 사람이 읽는 요약 (Human-readable summary)
+    QString summary() const;
+
+    /// CI 비교용 JSON (JSON for CI comparison)
+    QJsonObject toJson() const;
+};
+
+/**
+ * @class ReplayHarness
+ * @brief 트레이스 재생기 (Trace Replayer)
+ *
+ * 생성자에서 QClipboard::dataChanged에 연결하므로 반드시 MainWindow 다음에 만들어야 합니다.
+ * 같은 스레드의 직접 연결은 연결 순서대로 호출되므로, 알림을 받는 시점은 앱의 캡처가 끝난 뒤입니다.
+ * Connects to QClipboard::dataChanged in its constructor, so it must be created after MainWindow.
+ * Direct connections on one thread run in connection order, so the probe fires after the app has captured.
+ */
+class ReplayHarness : public QObject {
+    Q_OBJECT
+public:
+    /**
+     * @param events 재생할 트레이스 (Trace to replay)
+     * @param settleMs 마지막 이벤트 후 검증 전 대기 (Wait after the last event before verifying)
+     */
+    ReplayHarness(const QVector<TraceEvent> &events, int settleMs, QObject *parent = nullptr);
+
+    /**
+     * @brief 재생 시작 (Start replaying)
+     */
+    void start();
+
+    /**
+     * @brief 재생 결과, finished() 이후에 유효 (Replay results, valid after finished())
+     */
+    const ReplayReport &report() const { return m_report; }
+
+signals:
+    /**
+     * @brief 재생과 검증이 끝났을 때 발생 (Emitted once replay and verification are done)
+     */
+    void finished();
+
+private slots:
+    void sendNext();
+    void onClipboardChanged();
+    void finish();
+
+private:
+    void scheduleNext();
+    void verify();
+
+    QVector<TraceEvent> m_events;
+    int m_settleMs;
+    int m_next = 0;           ///< 다음에 보낼 이벤트 (Next event to send)
+    int m_unacked = 0;        ///< 알림을 아직 못 받은 이벤트 수 (Events not yet acknowledged)
+    qint64 m_inFlightDueNs = -1; ///< 마지막 전송 이벤트의 예정 시각 (Scheduled time of the last sent event)
+    QElapsedTimer m_clock;
+    ReplayReport m_report;
+};
+
+#endif // REPLAYHARNESS_HPP
@@ -0,0 +1,196 @@
+/**
+ * @file replay.cpp
+ * @brief 클립보드 부하 재생 도구 진입점 (Clipboard Load Replay Tool Entry Point)
+ *
+ * 기본적으로 offscreen 플랫폼과 임시 DB에서 MainWindow를 띄우고 트레이스를 재생합니다.
+ * --record는 실제 클립보드의 변경 시각과 크기만 트레이스로 기록합니다.
+ * By default runs MainWindow on the offscreen platform with a temporary database and replays a trace.
+ * --record captures only the timing and sizes of real clipboard changes as a trace.
+ *
+ * @author Rheehose (Rhee Creative)
+ * @date 2008-2026
+ */
+
+#include <QApplication>
+#include <QClipboard>
+#include <QMimeData>
+#include <QImage>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QDebug>
+#include <cstring>
+#include "../gui/MainWindow.hpp"
+#include "ClipboardTrace.hpp"
+#include "ReplayHarness.hpp"
+
+// 실제 클립보드를 기록할지 확인 (Check whether the real clipboard is being recorded)
+static bool hasRecordArgument(int argc, char *argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--record", 8) == 0) return true;
+    }
+    return false;
+}
+
+// 실제 클립보드 변경을 크기와 시각만 기록 (Record real clipboard changes as sizes and timing only)
+static int runRecord(QApplication &app, const QString &path, int durationSeconds) {
+    QVector<TraceEvent> events;
+    QElapsedTimer clock;
+    clock.start();
+
+    QClipboard *clipboard = QApplication::clipboard();
+    QObject::connect(clipboard, &QClipboard::dataChanged, &app, [&]() {
+        const QMimeData *mime = clipboard->mimeData();
+        if (!mime) return;
+        TraceEvent event;
+        event.atMs = clock.elapsed();
+        if (mime->hasImage()) {
+            const QImage image = qvariant_cast<QImage>(mime->imageData());
+            event.mime = TraceMime::Image;
+            event.imageSide = qMax(image.width(), image.height());
+        } else {
+            if (mime->hasHtml()) event.mime = TraceMime::Html;
+            else if (mime->hasUrls() && !mime->hasText()) event.mime = TraceMime::Urls;
+            event.text = mime->text();
+        }
+        events.append(event);
+        qInfo() << "기록됨 (Recorded):" << events.size();
+    });
+
+    qInfo() << "클립보드 기록 중 (Recording clipboard for)" << durationSeconds << "s";
+    QTimer::singleShot(durationSeconds * 1000, &app, &QCoreApplication::quit);
+    app.exec();
+
+    // 내용은 저장하지 않음: 비밀 정보가 트레이스 파일로 새지 않게 함 (Payloads are not stored so secrets never reach the trace file)
+    if (!ClipboardTrace::save(path, events, false)) return 1;
+    qInfo() << "트레이스 저장 완료 (Trace saved):" << events.size() << "events ->" << path;
+    return 0;
+}
+
+// "80,10,5,5" 형식의 MIME 비중 해석 (Parse MIME weights like "80,10,5,5")
+static bool parseMix(const QString &value, SyntheticProfile *profile) {
+    const QStringList parts = value.split(',');
+    if (parts.size() != 4) return false;
+    int weights[4];
+    for (int i = 0; i < 4; ++i) {
+        bool ok = false;
+        weights[i] = parts.at(i).trimmed().toInt(&ok);
+        if (!ok || weights[i] < 0) return false;
+    }
+    profile->textWeight = weights[0];
+    profile->htmlWeight = weights[1];
+    profile->urlWeight = weights[2];
+    profile->imageWeight = weights[3];
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const bool recording = hasRecordArgument(argc, argv);
+    if (!recording && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("Clipsmith");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Clipsmith clipboard load generator and replay harness");
+    parser.addHelpOption();
+    QCommandLineOption traceOption("trace", "재생할 JSONL 트레이스 (JSONL trace to replay instead of synthesizing)", "file");
+    QCommandLineOption saveTraceOption("save-trace", "합성한 트레이스 저장 (Save the synthesized trace)", "file");
+    QCommandLineOption recordOption("record", "실제 클립보드를 트레이스로 기록 (Record the real clipboard to a trace)", "file");
+    QCommandLineOption durationOption("duration", "기록 시간(초) (Recording time in seconds)", "seconds", "60");
+    QCommandLineOption countOption("count", "이벤트 수 (Number of events)", "n", "1000");
+    QCommandLineOption rateOption("rate", "버스트 안의 초당 이벤트 수, 0이면 최대 속도 (Events/s inside a burst, 0 floods)", "hz", "50");
+    QCommandLineOption burstOption("burst", "버스트당 이벤트 수 (Events per burst)", "n", "1");
+    QCommandLineOption burstGapOption("burst-gap", "버스트 사이 대기(ms) (Pause between bursts)", "ms", "0");
+    QCommandLineOption minSizeOption("min-size", "최소 내용 길이 (Minimum payload length)", "chars", "16");
+    QCommandLineOption maxSizeOption("max-size", "최대 내용 길이 (Maximum payload length)", "chars", "4096");
+    QCommandLineOption dupOption("dup-ratio", "다시 복사 비율 (Share of re-copied payloads)", "ratio", "0.05");
+    QCommandLineOption mixOption("mix", "text,html,urls,image 비중 (MIME weights)", "weights", "80,10,5,5");
+    QCommandLineOption seedOption("seed", "난수 시드 (Random seed)", "n", "1");
+    QCommandLineOption settleOption("settle", "검증 전 대기(ms) (Wait before verifying)", "ms", "1000");
+    QCommandLineOption dbOption("db", "임시 DB 대신 사용할 파일 (Database file instead of a temporary one)", "file");
+    QCommandLineOption reportOption("report", "JSON 결과 파일 (JSON report file)", "file");
+    QCommandLineOption maxLossOption("max-loss", "허용 손실 수, 넘으면 종료 코드 3 (Allowed losses, exit 3 above)", "n");
+    QCommandLineOption maxP99Option("max-p99", "허용 p99 지연(ms), 넘으면 종료 코드 3 (Allowed p99 latency, exit 3 above)", "ms");
+    parser.addOptions({traceOption, saveTraceOption, recordOption, durationOption, countOption, rateOption,
+                       burstOption, burstGapOption, minSizeOption, maxSizeOption, dupOption, mixOption, seedOption,
+                       settleOption, dbOption, reportOption, maxLossOption, maxP99Option});
+    parser.process(app);
+
+    if (parser.isSet(recordOption)) {
+        return runRecord(app, parser.value(recordOption), qMax(1, parser.value(durationOption).toInt()));
+    }
+
+    QVector<TraceEvent> events;
+    if (parser.isSet(traceOption)) {
+        if (!ClipboardTrace::load(parser.value(traceOption), &events)) return 1;
+    } else {
+        SyntheticProfile profile;
+        profile.count = parser.value(countOption).toInt();
+        profile.rate = parser.value(rateOption).toDouble();
+        profile.burstSize = qMax(1, parser.value(burstOption).toInt());
+        profile.burstGapMs = qMax(0, parser.value(burstGapOption).toInt());
+        profile.minSize = qMax(1, parser.value(minSizeOption).toInt());
+        profile.maxSize = qMax(profile.minSize, parser.value(maxSizeOption).toInt());
+        profile.duplicateRatio = parser.value(dupOption).toDouble();
+        profile.seed = parser.value(seedOption).toUInt();
+        if (!parseMix(parser.value(mixOption), &profile)) {
+            qCritical() << "잘못된 --mix 값 (Invalid --mix):" << parser.value(mixOption);
+            return 2;
+        }
+        events = ClipboardTrace::generate(profile);
+        if (parser.isSet(saveTraceOption) && !ClipboardTrace::save(parser.value(saveTraceOption), events)) return 1;
+    }
+    if (events.isEmpty()) {
+        qCritical() << "재생할 이벤트가 없습니다 (No events to replay)";
+        return 2;
+    }
+
+    // 사용자의 히스토리와 규칙 파일을 건드리지 않도록 격리 (Isolate from the user's history and rule file)
+    QStandardPaths::setTestModeEnabled(true);
+    QTemporaryDir tempDir;
+    const QString dbPath = parser.isSet(dbOption) ? parser.value(dbOption) : tempDir.filePath("replay.db");
+    if (!parser.isSet(dbOption) && !tempDir.isValid()) {
+        qCritical() << "임시 디렉터리 생성 실패 (Cannot create a temporary directory)";
+        return 1;
+    }
+    qputenv("CLIPSMITH_DB_PATH", QFile::encodeName(dbPath));
+
+    MainWindow window;
+    window.show();
+
+    ReplayHarness harness(events, qMax(0, parser.value(settleOption).toInt()));
+    QObject::connect(&harness, &ReplayHarness::finished, &app, &QCoreApplication::quit);
+    QTimer::singleShot(0, &harness, &ReplayHarness::start);
+    app.exec();
+
+    const ReplayReport &report = harness.report();
+    qInfo().noquote() << report.summary();
+
+    if (parser.isSet(reportOption)) {
+        QFile file(parser.value(reportOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)
+            || file.write(QJsonDocument(report.toJson()).toJson()) < 0) {
+            qCritical() << "결과 파일 쓰기 실패 (Cannot write report):" << file.errorString();
+            return 1;
+        }
+    }
+
+    bool regressed = false;
+    if (parser.isSet(maxLossOption) && report.lost() > parser.value(maxLossOption).toInt()) {
+        qCritical() << "손실 한도 초과 (Capture loss above limit):" << report.lost();
+        regressed = true;
+    }
+    if (parser.isSet(maxP99Option) && report.percentile(99) > parser.value(maxP99Option).toDouble()) {
+        qCritical() << "p99 지연 한도 초과 (p99 latency above limit):" << report.percentile(99) << "ms";
+        regressed = true;
+    }
+    return regressed ? 3 : 0;
+}